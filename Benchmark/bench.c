@@ -0,0 +1,89 @@
+/*
+ * File Name --> bench.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Application
+ * Brief	 --> Common harness of EduRTOS benchmarks.
+ * */
+
+#include "EduRTOS_Config.h"
+
+/*Benchmarks are built by CMake only, So they don't conflict with main function of microcontroller projects.*/
+#ifdef EduRTOS_CMAKE_BUILD
+
+#include <stdlib.h>
+#include "bench.h"
+
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+#include <time.h>
+#endif
+
+void Bench_Init(void){
+#if (EduRTOS_Config_PORT == EduRTOS_PORT_ARM_CM4) && (EduRTOS_Config_BOARD != EduRTOS_BOARD_MPS2_AN386)
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+Bench_Time Bench_Now(void){
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+	struct timespec Now;
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return (Bench_Time)(((Edu_u64)Now.tv_sec * 1000000000ULL) + (Edu_u64)Now.tv_nsec);
+#elif EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+	/*QEMU doesn't implement DWT cycle counter, so counts of SysTick are extended by tick number.*/
+	Edu_u32 Tick;
+	Edu_u32 Value;
+	do{
+		Tick = EduRTOS_GetCurrentTickNumber();
+		Value = SysTick->VAL;
+	}while (Tick != EduRTOS_GetCurrentTickNumber());
+	return (Bench_Time)((Tick * EduRTOS_SystickReloadTicks) + ((EduRTOS_SystickReloadTicks - 1) - Value));
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+static int Bench_CompareSamples(const void *First, const void *Second){
+	const Bench_Time FirstSample = *(const Bench_Time *)First;
+	const Bench_Time SecondSample = *(const Bench_Time *)Second;
+	return (FirstSample > SecondSample) - (FirstSample < SecondSample);
+}
+
+void Bench_Report(const char * const Name, const Edu_u32 Tasks, Bench_Time * const Samples, const Edu_u32 Count){
+	if (0 == Count){
+		return;
+	}
+	qsort(Samples, Count, sizeof(Bench_Time), Bench_CompareSamples);
+
+	Edu_u64 Sum = 0;
+	for (Edu_u32 i = 0; i < Count; i++){
+		Sum += Samples[i];
+	}
+	/*Nearest rank percentile.*/
+	const Edu_u32 P99Index = ((Count * 99) + 99) / 100 - 1;
+
+	Bench_Print("{\"benchmark\":\"%s\",\"port\":\"%s\",\"unit\":\"%s\",\"tasks\":%lu,\"samples\":%lu,"
+			"\"min\":%lu,\"mean\":%lu,\"p99\":%lu,\"max\":%lu}\n",
+			Name, Bench_PORT_NAME, Bench_TIME_UNIT, (unsigned long)Tasks, (unsigned long)Count,
+			(unsigned long)Samples[0], (unsigned long)(Sum / Count),
+			(unsigned long)Samples[P99Index], (unsigned long)Samples[Count - 1]);
+}
+
+void Bench_ReportThroughput(const char * const Name, const char * const Arrangement, const Edu_u32 Size,
+		const Edu_u32 Tasks, const Edu_u32 Operations, const Bench_Time Elapsed){
+	const Edu_u64 OperationsPerSecond = (0 == Elapsed) ? 0 : (((Edu_u64)Operations * Bench_CLOCK_HZ) / Elapsed);
+
+	Bench_Print("{\"benchmark\":\"%s\",\"port\":\"%s\",\"arrangement\":\"%s\",\"size\":%lu,\"tasks\":%lu,"
+			"\"operations\":%lu,\"elapsed\":%lu,\"unit\":\"%s\",\"ops_per_sec\":%lu}\n",
+			Name, Bench_PORT_NAME, Arrangement, (unsigned long)Size, (unsigned long)Tasks,
+			(unsigned long)Operations, (unsigned long)Elapsed, Bench_TIME_UNIT, (unsigned long)OperationsPerSecond);
+}
+
+void Bench_Exit(const int Status){
+	Bench_Print("{\"done\":true,\"status\":%d}\n", Status);
+	exit(Status);
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * File Name --> bench.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Application
+ * Brief	 --> Common harness of EduRTOS benchmarks, Clock of port, statistics and machine-readable report.
+ * */
+
+#ifndef EDUCATIONALRTOS_BENCH_H_
+#define EDUCATIONALRTOS_BENCH_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include <stdio.h>
+#include "EduRTOS.h"
+#include "Port/port.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Data Type Declaration
+==================================================
+ */
+
+/*Timestamp in units of Bench_TIME_UNIT, Differences are correct across wrap around.*/
+typedef Edu_u32 Bench_Time;
+
+/*Bench_CLOCK_HZ is number of clock units in one second.*/
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+#define 	Bench_PORT_NAME			"posix"
+#define 	Bench_TIME_UNIT			"ns"
+#define 	Bench_CLOCK_HZ			1000000000ULL
+#elif EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+#define 	Bench_PORT_NAME			"mps2-an386"
+#define 	Bench_TIME_UNIT			"cycles"
+#define 	Bench_CLOCK_HZ			EduRTOS_Config_CLOCK_HZ
+#else
+#define 	Bench_PORT_NAME			"arm-cm4"
+#define 	Bench_TIME_UNIT			"cycles"
+#define 	Bench_CLOCK_HZ			EduRTOS_Config_CLOCK_HZ
+#endif
+
+/*C library functions (like printf) aren't reentrant, so they are called inside critical section.*/
+#define 	Bench_Print(...)		do{ EduRTOS_EnterCritical(); printf(__VA_ARGS__); fflush(stdout); EduRTOS_ExitCritical(); }while(0)
+/*
+==================================================
+  End Section --> Data Type Declaration
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  --> Initialize clock of benchmarks (Enables DWT cycle counter on ARM).
+ * */
+void Bench_Init(void);
+
+/* @brief  --> Read clock of port.
+ * @retval --> Timestamp, nanoseconds on POSIX port or processor cycles on ARM port.
+ * */
+Bench_Time Bench_Now(void);
+
+/* @brief  			--> Sort samples and print one JSON line with min, mean, p99 and max of samples.
+ * @param  Name 	--> Name of benchmark.
+ * @param  Tasks 	--> Number of created tasks (including idle task) while samples were taken.
+ * @param  Samples 	--> Array of samples, It's sorted in place.
+ * @param  Count 	--> Number of samples.
+ * */
+void Bench_Report(const char * const Name, const Edu_u32 Tasks, Bench_Time * const Samples, const Edu_u32 Count);
+
+/* @brief  				--> Print one JSON line with elapsed time and operations per second of throughput benchmark.
+ * @param  Name 		--> Name of benchmark.
+ * @param  Arrangement 	--> Priority arrangement of tasks (like "producer_high").
+ * @param  Size 		--> Buffer size (or length of critical section for mutex benchmarks).
+ * @param  Tasks 		--> Number of tasks that run benchmark.
+ * @param  Operations 	--> Number of completed operations.
+ * @param  Elapsed 		--> Time of all operations, It must be less than wrap around time of clock.
+ * */
+void Bench_ReportThroughput(const char * const Name, const char * const Arrangement, const Edu_u32 Size,
+		const Edu_u32 Tasks, const Edu_u32 Operations, const Bench_Time Elapsed);
+
+/* @brief  		  --> Print end line of benchmark and exit (Stops QEMU on mps2-an386 board).
+ * @param  Status --> Exit status.
+ * */
+void Bench_Exit(const int Status);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+
+#endif /* EDUCATIONALRTOS_BENCH_H_ */
@@ -0,0 +1,254 @@
+/*
+ * File Name --> bench_latency.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Application
+ * Brief	 --> Context switching latency and jitter benchmark, It measures
+ * context_switch : From EduRTOS_TaskYield of one task till the other task continues (Trigger + switch handler).
+ * wakeup_latency : From SemaphoreGive till higher priority task that waits semaphore continues.
+ * tick_overhead  : Time stolen from running task by tick interrupt (without context switching).
+ * Each benchmark is repeated while number of tasks grows by filler tasks (blocked tasks) till all TCBs are used.
+ * */
+
+#include "EduRTOS_Config.h"
+
+/*Benchmarks are built by CMake only, So they don't conflict with main function of microcontroller projects.*/
+#ifdef EduRTOS_CMAKE_BUILD
+
+#include "bench.h"
+
+/*
+==================================================
+  Start Section --> Benchmark Configurations
+==================================================
+ */
+#define 	Bench_SAMPLES				1000
+/*First samples include cold start (like returning from SemaphoreTake), so they are dropped.*/
+#define 	Bench_WARMUP				16
+#define 	Bench_TICK_SAMPLES			20
+
+#define 	Bench_CONTROLLER_PRIORITY	10
+#define 	Bench_YIELD_A_PRIORITY		9
+#define 	Bench_YIELD_B_PRIORITY		8
+#define 	Bench_WAITER_PRIORITY		7
+#define 	Bench_GIVER_PRIORITY		6
+/*Filler tasks take the rest of priorities (5 --> 1), Then more fillers share priority 1.*/
+#define 	Bench_MAX_FILLER_PRIORITY	5
+
+#define 	Bench_CONTROLLER_STACK_SIZE	(4*1024)
+/*
+==================================================
+  End Section --> Benchmark Configurations
+==================================================
+ */
+
+#if Bench_CONTROLLER_PRIORITY > EduRTOS_Config_MAX_PRIORITY
+#error "Latency benchmark requires EduRTOS_Config_MAX_PRIORITY >= 10"
+#endif
+
+/*Length of tick period in units of clock.*/
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+#define 	Bench_TICK_PERIOD			(EduRTOS_Config_Systick_RATE_ms * 1000000UL)
+#else
+#define 	Bench_TICK_PERIOD			EduRTOS_SystickReloadTicks
+#endif
+
+static Semaphore YieldStartSemaphoreA;
+static Semaphore YieldStartSemaphoreB;
+static Semaphore GiverStartSemaphore;
+static Semaphore WakeupSemaphore;
+static Semaphore FillerSemaphore;
+static Semaphore DoneSemaphore;
+
+static Bench_Time Samples[Bench_SAMPLES];
+static volatile Edu_u32 SampleIndex;
+static volatile Bench_Time SwitchStamp;
+static volatile Edu_u32 FinishedYieldTasks;
+
+/* @brief  		  --> Store sample, Warm up samples and samples after the last one are dropped.
+ * @param  Sample --> Measured latency.
+ * */
+static void Bench_StoreSample(const Bench_Time Sample){
+	const Edu_u32 Index = SampleIndex;
+	if ((Index >= Bench_WARMUP) && (Index < (Bench_WARMUP + Bench_SAMPLES))){
+		Samples[Index - Bench_WARMUP] = Sample;
+	}
+	SampleIndex = Index + 1;
+}
+
+static void Bench_YieldLoop(Semaphore * const StartSemaphore){
+	while(1){
+		SemaphoreTake(StartSemaphore, EduRTOS_INFINITE);
+		/*Two tasks yield to each other, Each one measures switching from the other one.*/
+		while (SampleIndex < (Bench_WARMUP + Bench_SAMPLES)){
+			SwitchStamp = Bench_Now();
+			EduRTOS_TaskYield();
+			Bench_StoreSample(Bench_Now() - SwitchStamp);
+		}
+
+		EduRTOS_EnterCritical();
+		const Edu_u32 FinishedTasks = ++FinishedYieldTasks;
+		EduRTOS_ExitCritical();
+		if (2 == FinishedTasks){
+			SemaphoreGive(&DoneSemaphore, EduRTOS_INFINITE);
+		}
+	}
+}
+
+static void Task_YieldA(void){
+	Bench_YieldLoop(&YieldStartSemaphoreA);
+}
+
+static void Task_YieldB(void){
+	Bench_YieldLoop(&YieldStartSemaphoreB);
+}
+
+static void Task_Waiter(void){
+	while(1){
+		SemaphoreTake(&WakeupSemaphore, EduRTOS_INFINITE);
+		Bench_StoreSample(Bench_Now() - SwitchStamp);
+	}
+}
+
+static void Task_Giver(void){
+	while(1){
+		SemaphoreTake(&GiverStartSemaphore, EduRTOS_INFINITE);
+		/*Waiter has higher priority, so it runs right after semaphore is given.*/
+		for (Edu_u32 i = 0; i < (Bench_WARMUP + Bench_SAMPLES); i++){
+			SwitchStamp = Bench_Now();
+			SemaphoreGive(&WakeupSemaphore, EduRTOS_INFINITE);
+		}
+		SemaphoreGive(&DoneSemaphore, EduRTOS_INFINITE);
+	}
+}
+
+static void Task_Filler(void){
+	/*Filler tasks only increase number of tasks, so they are blocked forever.*/
+	while(1){
+		SemaphoreTake(&FillerSemaphore, EduRTOS_INFINITE);
+	}
+}
+
+static void Bench_ContextSwitch(void){
+	SampleIndex = 0;
+	FinishedYieldTasks = 0;
+	SemaphoreGive(&YieldStartSemaphoreA, EduRTOS_INFINITE);
+	SemaphoreGive(&YieldStartSemaphoreB, EduRTOS_INFINITE);
+	SemaphoreTake(&DoneSemaphore, EduRTOS_INFINITE);
+	Bench_Report("context_switch", EduRTOS_GetNumberOfCreatedTasks(), Samples, Bench_SAMPLES);
+}
+
+static void Bench_WakeupLatency(void){
+	SampleIndex = 0;
+	SemaphoreGive(&GiverStartSemaphore, EduRTOS_INFINITE);
+	SemaphoreTake(&DoneSemaphore, EduRTOS_INFINITE);
+	Bench_Report("wakeup_latency", EduRTOS_GetNumberOfCreatedTasks(), Samples, Bench_SAMPLES);
+}
+
+/* @brief  		--> Read clock while tick number doesn't change, So tick interrupt is before or after timestamp.
+ * @param  Now 	--> Pointer to store timestamp.
+ * @param  Tick --> Pointer to store tick number.
+ * @retval 		--> Edu_False if tick interrupt happened while clock is read.
+ * */
+static Edu_Bool Bench_ReadClockAndTick(Bench_Time * const Now, Edu_u32 * const Tick){
+	const Edu_u32 TickBefore = EduRTOS_GetCurrentTickNumber();
+	*Now = Bench_Now();
+	*Tick = EduRTOS_GetCurrentTickNumber();
+	return (TickBefore == *Tick) ? Edu_True : Edu_False;
+}
+
+static void Bench_TickOverhead(void){
+	Bench_Time Now;
+	Bench_Time Previous;
+	Edu_u32 Tick;
+	Edu_u32 PreviousTick;
+
+	/*Minimum time of one loop iteration, It's subtracted from gaps that contain tick interrupt.*/
+	Bench_Time MinimumIteration = Bench_TICK_PERIOD;
+	Bench_ReadClockAndTick(&Previous, &PreviousTick);
+	for (Edu_u32 i = 0; i < 1000; i++){
+		if ((Edu_True == Bench_ReadClockAndTick(&Now, &Tick)) && ((Now - Previous) < MinimumIteration)){
+			MinimumIteration = Now - Previous;
+		}
+		Previous = Now;
+	}
+
+	/* Controller is the only ready task, so gap between two timestamps in which tick number changes contains tick interrupt.
+	 * Gaps longer than half tick are dropped, as controller is switched out when its time slots finish.*/
+	Edu_u32 Count = 0;
+	Edu_Bool PreviousValid = Bench_ReadClockAndTick(&Previous, &PreviousTick);
+	while (Count < Bench_TICK_SAMPLES){
+		const Edu_Bool Valid = Bench_ReadClockAndTick(&Now, &Tick);
+		const Bench_Time Gap = Now - Previous;
+		if ((Edu_True == Valid) && (Edu_True == PreviousValid) && (Tick != PreviousTick)
+				&& (Gap >= MinimumIteration) && (Gap < (Bench_TICK_PERIOD / 2))){
+			Samples[Count++] = Gap - MinimumIteration;
+		}
+		PreviousValid = Valid;
+		PreviousTick = Tick;
+		Previous = Now;
+	}
+	Bench_Report("tick_overhead", EduRTOS_GetNumberOfCreatedTasks(), Samples, Count);
+}
+
+static void Bench_RunAll(void){
+	Bench_ContextSwitch();
+	Bench_WakeupLatency();
+	Bench_TickOverhead();
+}
+
+/* @brief  			 --> Create filler task and let it run and block.
+ * @param  Priority --> Priority of filler task.
+ * @retval --> Edu_False if all TCBs are used.
+ * */
+static Edu_Bool Bench_AddFiller(const Edu_u32 Priority){
+	if (EduRTOS_INVALID_TASK == EduRTOS_CreateTask(Task_Filler, Priority, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL)){
+		return Edu_False;
+	}
+	EduRTOS_TaskDelayUntil(2);
+	return Edu_True;
+}
+
+static void Task_Controller(void){
+	Bench_RunAll();
+	for (Edu_u32 FillerPriority = Bench_MAX_FILLER_PRIORITY; FillerPriority > 0; FillerPriority--){
+		if (Edu_True != Bench_AddFiller(FillerPriority)){
+			Bench_Exit(0);
+		}
+		Bench_RunAll();
+	}
+	/*Number of tasks is doubled till all TCBs are used (EduRTOS_Config_MAX_NUMBER_OF_TASKS may be defined by build system).*/
+	Edu_u32 NumberOfTasks = 0;
+	for (Edu_u32 Target = 16; NumberOfTasks != EduRTOS_GetNumberOfCreatedTasks(); Target *= 2){
+		NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+		while ((EduRTOS_GetNumberOfCreatedTasks() < Target) && (Edu_True == Bench_AddFiller(1))){
+		}
+		if (NumberOfTasks != EduRTOS_GetNumberOfCreatedTasks()){
+			Bench_RunAll();
+		}
+	}
+	Bench_Exit(0);
+}
+
+int main(void)
+{
+	Bench_Init();
+	EduRTOS_Init();
+	SemaphoreInit(&YieldStartSemaphoreA, 0);
+	SemaphoreInit(&YieldStartSemaphoreB, 0);
+	SemaphoreInit(&GiverStartSemaphore, 0);
+	SemaphoreInit(&WakeupSemaphore, 0);
+	SemaphoreInit(&FillerSemaphore, 0);
+	SemaphoreInit(&DoneSemaphore, 0);
+
+	EduRTOS_CreateTask(Task_Controller, Bench_CONTROLLER_PRIORITY, Bench_CONTROLLER_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_YieldA, Bench_YIELD_A_PRIORITY, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_YieldB, Bench_YIELD_B_PRIORITY, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_Waiter, Bench_WAITER_PRIORITY, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_Giver, Bench_GIVER_PRIORITY, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	RTOS_Start_Scheduler();
+
+	return 1;
+}
+
+#endif
@@ -0,0 +1,290 @@
+/*
+ * File Name --> bench_throughput.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Application
+ * Brief	 --> Throughput benchmark of synchronization primitives (operations per second), It measures
+ * mailbox_stream     : Producer writes to mailbox and consumer reads it, for each buffer size.
+ * mailbox_pingpong   : Two tasks exchange request and response through two mailboxes (one operation is round trip).
+ * semaphore_handoff  : Producer and consumer hand off buffer slots by two semaphores, for each buffer size.
+ * notify_handoff     : Same as semaphore_handoff, but slots and items are counted by task notifications.
+ * mutex_contention   : Tasks lock the same mutex for each number of tasks and critical section length.
+ * Producer/consumer benchmarks are repeated with producer at higher priority and with consumer at higher priority.
+ * Data and shared counter are checked, so benchmark exits with non-zero status if primitive loses or reorders data.
+ * */
+
+#include "EduRTOS_Config.h"
+
+/*Benchmarks are built by CMake only, So they don't conflict with main function of microcontroller projects.*/
+#ifdef EduRTOS_CMAKE_BUILD
+
+#include "bench.h"
+
+/*
+==================================================
+  Start Section --> Benchmark Configurations
+==================================================
+ */
+#define 	Bench_OPERATIONS			20000
+#define 	Bench_MAX_BUFFER_SIZE		64
+
+#define 	Bench_CONTROLLER_PRIORITY	10
+/*Workers take priorities 9, 8, 7 and 6, Worker 0 has the highest priority.*/
+#define 	Bench_WORKERS				4
+#define 	Bench_WORKER_0_PRIORITY		9
+
+#define 	Bench_CONTROLLER_STACK_SIZE	(4*1024)
+/*
+==================================================
+  End Section --> Benchmark Configurations
+==================================================
+ */
+
+#if Bench_CONTROLLER_PRIORITY > EduRTOS_Config_MAX_PRIORITY
+#error "Throughput benchmark requires EduRTOS_Config_MAX_PRIORITY >= 10"
+#endif
+
+static const Edu_u32 BufferSizes[] = {1, 4, 16, Bench_MAX_BUFFER_SIZE};
+static const Edu_u32 Contenders[] = {1, 2, 4};
+/*Loop iterations inside critical section of mutex.*/
+static const Edu_u32 HoldLengths[] = {0, 64};
+
+static Semaphore WorkerStartSemaphores[Bench_WORKERS];
+static Semaphore DoneSemaphore;
+/*Job of each worker in current benchmark.*/
+static void (* volatile WorkerJobs[Bench_WORKERS])(void);
+static TaskId WorkerTaskIds[Bench_WORKERS];
+
+static MailBox RequestMailbox;
+static MailBox ResponseMailbox;
+static Edu_u32 RequestBuffer[Bench_MAX_BUFFER_SIZE];
+static Edu_u32 ResponseBuffer[Bench_MAX_BUFFER_SIZE];
+static Semaphore SlotsSemaphore;
+static Semaphore ItemsSemaphore;
+static Mutex ContendedMutex;
+
+/*Parameters of current benchmark.*/
+static volatile Edu_u32 JobOperations;
+static volatile Edu_u32 JobBufferSize;
+static volatile Edu_u32 HoldLength;
+static volatile Edu_u32 SharedCounter;
+static volatile Edu_u32 Errors;
+
+static void Job_MailboxProducer(void){
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		MailBoxWrite(&RequestMailbox, i, EduRTOS_INFINITE);
+	}
+}
+
+static void Job_MailboxConsumer(void){
+	Edu_u32 Data;
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		if ((EduRTOS_Mailbox_ReadSucceed != MailBoxRead(&RequestMailbox, &Data, EduRTOS_INFINITE)) || (Data != i)){
+			Errors++;
+		}
+	}
+}
+
+static void Job_Ping(void){
+	Edu_u32 Data;
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		MailBoxWrite(&RequestMailbox, i, EduRTOS_INFINITE);
+		if ((EduRTOS_Mailbox_ReadSucceed != MailBoxRead(&ResponseMailbox, &Data, EduRTOS_INFINITE)) || (Data != (i + 1))){
+			Errors++;
+		}
+	}
+}
+
+static void Job_Pong(void){
+	Edu_u32 Data;
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		MailBoxRead(&RequestMailbox, &Data, EduRTOS_INFINITE);
+		MailBoxWrite(&ResponseMailbox, Data + 1, EduRTOS_INFINITE);
+	}
+}
+
+static void Job_SemaphoreProducer(void){
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		SemaphoreTake(&SlotsSemaphore, EduRTOS_INFINITE);
+		SemaphoreGive(&ItemsSemaphore, EduRTOS_INFINITE);
+	}
+}
+
+static void Job_SemaphoreConsumer(void){
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		SemaphoreTake(&ItemsSemaphore, EduRTOS_INFINITE);
+		SemaphoreGive(&SlotsSemaphore, EduRTOS_INFINITE);
+	}
+}
+
+/* @brief  		--> Find task that runs job in current benchmark.
+ * @param  Job 	--> Job of worker.
+ * @retval 		--> Id of worker task.
+ * */
+static TaskId Bench_JobTaskId(void (* const Job)(void)){
+	for (Edu_u32 i = 0; i < Bench_WORKERS; i++){
+		if (Job == WorkerJobs[i]){
+			return WorkerTaskIds[i];
+		}
+	}
+	return WorkerTaskIds[0];
+}
+
+static void Job_NotifyConsumer(void);
+
+static void Job_NotifyProducer(void){
+	const TaskId ConsumerId = Bench_JobTaskId(Job_NotifyConsumer);
+	/*Slots returned at end of previous run are dropped, Consumer doesn't return slots before it takes items.*/
+	(void)EduRTOS_TaskNotifyTake(Edu_True, 0);
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		/*The first JobBufferSize slots are free.*/
+		if ((i >= JobBufferSize) && (0 == EduRTOS_TaskNotifyTake(Edu_False, EduRTOS_INFINITE))){
+			Errors++;
+		}
+		EduRTOS_TaskNotify(ConsumerId, 0, EduTask_Notify_Increment);
+	}
+}
+
+static void Job_NotifyConsumer(void){
+	const TaskId ProducerId = Bench_JobTaskId(Job_NotifyProducer);
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		if (0 == EduRTOS_TaskNotifyTake(Edu_False, EduRTOS_INFINITE)){
+			Errors++;
+		}
+		EduRTOS_TaskNotify(ProducerId, 0, EduTask_Notify_Increment);
+	}
+}
+
+static void Job_MutexContender(void){
+	for (Edu_u32 i = 0; i < JobOperations; i++){
+		MutexLock(&ContendedMutex, EduRTOS_INFINITE);
+		/*Read and write are separated by hold loop, so lost update appears if mutex doesn't protect counter.*/
+		const Edu_u32 Counter = SharedCounter;
+		for (volatile Edu_u32 Hold = 0; Hold < HoldLength; Hold++){
+		}
+		SharedCounter = Counter + 1;
+		MutexRelease(&ContendedMutex, EduRTOS_INFINITE);
+	}
+}
+
+static void Task_Worker(Edu_u32 WorkerIndex){
+	while(1){
+		SemaphoreTake(&WorkerStartSemaphores[WorkerIndex], EduRTOS_INFINITE);
+		WorkerJobs[WorkerIndex]();
+		SemaphoreGive(&DoneSemaphore, EduRTOS_INFINITE);
+	}
+}
+
+/* @brief  			--> Start jobs on workers (Worker 0 has the highest priority) and wait till all of them finish.
+ * @param  Jobs 	--> Array of jobs.
+ * @param  Workers 	--> Number of workers that run jobs.
+ * @retval 			--> Elapsed time of jobs.
+ * */
+static Bench_Time Bench_RunJobs(void (* const Jobs[])(void), const Edu_u32 Workers){
+	for (Edu_u32 i = 0; i < Workers; i++){
+		WorkerJobs[i] = Jobs[i];
+	}
+	/*Controller has the highest priority, so workers start once it waits done semaphore.*/
+	const Bench_Time Start = Bench_Now();
+	for (Edu_u32 i = 0; i < Workers; i++){
+		SemaphoreGive(&WorkerStartSemaphores[i], EduRTOS_INFINITE);
+	}
+	for (Edu_u32 i = 0; i < Workers; i++){
+		SemaphoreTake(&DoneSemaphore, EduRTOS_INFINITE);
+	}
+	return Bench_Now() - Start;
+}
+
+/* @brief  				--> Run producer and consumer jobs in both priority arrangements and report them.
+ * @param  Name 		--> Name of benchmark.
+ * @param  Size 		--> Buffer size.
+ * @param  Producer 	--> Producer job.
+ * @param  Consumer 	--> Consumer job.
+ * @param  Setup 		--> Initialize primitives before each run.
+ * */
+static void Bench_RunPair(const char * const Name, const Edu_u32 Size,
+		void (* const Producer)(void), void (* const Consumer)(void), void (* const Setup)(Edu_u32)){
+	void (* const ProducerHigh[])(void) = {Producer, Consumer};
+	void (* const ConsumerHigh[])(void) = {Consumer, Producer};
+
+	JobOperations = Bench_OPERATIONS;
+	Setup(Size);
+	Bench_ReportThroughput(Name, "producer_high", Size, 2, Bench_OPERATIONS, Bench_RunJobs(ProducerHigh, 2));
+	Setup(Size);
+	Bench_ReportThroughput(Name, "consumer_high", Size, 2, Bench_OPERATIONS, Bench_RunJobs(ConsumerHigh, 2));
+}
+
+static void Setup_Mailboxes(const Edu_u32 Size){
+	MailBoxInit(&RequestMailbox, RequestBuffer, Size);
+	MailBoxInit(&ResponseMailbox, ResponseBuffer, Size);
+}
+
+static void Setup_Semaphores(const Edu_u32 Size){
+	SemaphoreInit(&SlotsSemaphore, Size);
+	SemaphoreInit(&ItemsSemaphore, 0);
+}
+
+static void Setup_Notifications(const Edu_u32 Size){
+	JobBufferSize = Size;
+}
+
+static void Bench_MutexContention(const char * const Arrangement, const Edu_u32 Ceiling){
+	void (* const Jobs[Bench_WORKERS])(void) = {Job_MutexContender, Job_MutexContender, Job_MutexContender, Job_MutexContender};
+
+	for (Edu_u32 i = 0; i < (sizeof(Contenders) / sizeof(Contenders[0])); i++){
+		for (Edu_u32 j = 0; j < (sizeof(HoldLengths) / sizeof(HoldLengths[0])); j++){
+			if (Ceiling){
+				MutexInitWithCeiling(&ContendedMutex, Bench_WORKER_0_PRIORITY);
+			}
+			else{
+				MutexInit(&ContendedMutex);
+			}
+			JobOperations = Bench_OPERATIONS / Contenders[i];
+			HoldLength = HoldLengths[j];
+			SharedCounter = 0;
+			const Bench_Time Elapsed = Bench_RunJobs(Jobs, Contenders[i]);
+			if (SharedCounter != (JobOperations * Contenders[i])){
+				Errors++;
+			}
+			Bench_ReportThroughput("mutex_contention", Arrangement, HoldLengths[j], Contenders[i], SharedCounter, Elapsed);
+		}
+	}
+}
+
+static void Task_Controller(void){
+	for (Edu_u32 i = 0; i < (sizeof(BufferSizes) / sizeof(BufferSizes[0])); i++){
+		Bench_RunPair("mailbox_stream", BufferSizes[i], Job_MailboxProducer, Job_MailboxConsumer, Setup_Mailboxes);
+	}
+	/*Ping waits each response, so larger buffers don't change ping pong.*/
+	Bench_RunPair("mailbox_pingpong", 1, Job_Ping, Job_Pong, Setup_Mailboxes);
+	for (Edu_u32 i = 0; i < (sizeof(BufferSizes) / sizeof(BufferSizes[0])); i++){
+		Bench_RunPair("semaphore_handoff", BufferSizes[i], Job_SemaphoreProducer, Job_SemaphoreConsumer, Setup_Semaphores);
+	}
+	for (Edu_u32 i = 0; i < (sizeof(BufferSizes) / sizeof(BufferSizes[0])); i++){
+		Bench_RunPair("notify_handoff", BufferSizes[i], Job_NotifyProducer, Job_NotifyConsumer, Setup_Notifications);
+	}
+	Bench_MutexContention("inheritance", 0);
+	Bench_MutexContention("ceiling", 1);
+	Bench_Exit((0 == Errors) ? 0 : 1);
+}
+
+int main(void)
+{
+	TaskParameters WorkerParameters = {0};
+
+	Bench_Init();
+	EduRTOS_Init();
+	SemaphoreInit(&DoneSemaphore, 0);
+
+	EduRTOS_CreateTask(Task_Controller, Bench_CONTROLLER_PRIORITY, Bench_CONTROLLER_STACK_SIZE, EduRTOS_NULL);
+	for (Edu_u32 i = 0; i < Bench_WORKERS; i++){
+		SemaphoreInit(&WorkerStartSemaphores[i], 0);
+		WorkerParameters.arg1_32bit = i;
+		WorkerTaskIds[i] = EduRTOS_CreateTask(Task_Worker, Bench_WORKER_0_PRIORITY - i, EduRTOS_Config_TASK_MIN_STACK_SIZE, &WorkerParameters);
+	}
+	RTOS_Start_Scheduler();
+
+	return 1;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+File Name --> compare.py
+Author    --> Ahmed Mohamed Abd-Elfattah
+Version   --> 1.0.0
+Brief     --> Compare JSON lines of two benchmark runs (baseline and new) and report regressions.
+              Latency results are compared by mean and p99 (lower is better), and throughput results
+              are compared by ops_per_sec (higher is better). Exit status is 1 if any result regressed
+              more than threshold.
+
+Usage     --> ./build/EduRTOS_Bench_Throughput > baseline.jsonl
+              (apply change and rebuild)
+              ./build/EduRTOS_Bench_Throughput > new.jsonl
+              python3 Benchmark/compare.py baseline.jsonl new.jsonl --threshold 10
+"""
+
+import argparse
+import json
+import sys
+
+# Fields that identify result, other fields are measurements.
+KEY_FIELDS = ("benchmark", "port", "arrangement", "size", "tasks")
+LOWER_IS_BETTER = ("mean", "p99")
+HIGHER_IS_BETTER = ("ops_per_sec",)
+
+
+def load_results(path):
+    results = {}
+    with open(path) as file:
+        for line in file:
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            result = json.loads(line)
+            if "benchmark" not in result:
+                continue
+            key = tuple(str(result.get(field, "")) for field in KEY_FIELDS)
+            results[key] = result
+    return results
+
+
+def change_percent(baseline, new):
+    if baseline == 0:
+        return 0.0
+    return (new - baseline) * 100.0 / baseline
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two runs of EduRTOS benchmarks.")
+    parser.add_argument("baseline", help="JSON lines of baseline run")
+    parser.add_argument("new", help="JSON lines of new run")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Regression threshold in percent (default 10)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    new = load_results(args.new)
+    regressions = 0
+
+    for key in sorted(baseline):
+        if key not in new:
+            print("missing     " + " ".join(key))
+            continue
+        for field in LOWER_IS_BETTER + HIGHER_IS_BETTER:
+            if field not in baseline[key] or field not in new[key]:
+                continue
+            change = change_percent(baseline[key][field], new[key][field])
+            worse = -change if field in HIGHER_IS_BETTER else change
+            status = "ok"
+            if worse > args.threshold:
+                status = "REGRESSION"
+                regressions += 1
+            print("%-11s %s %s: %s -> %s (%+.1f%%)" % (status, " ".join(key), field,
+                                                      baseline[key][field], new[key][field], change))
+
+    print("%d regression(s) above %.1f%%" % (regressions, args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,647 @@
+/*
+ * File Name --> demo.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Application
+ * Brief	 --> Runs examples of Mutex, Semaphore, Mailbox, Memory pool and Heap, and scenarios of scheduling and priority protocols,
+ * Prints results and exits with status 0 if all of them give expected results (POSIX port or QEMU board).
+ * */
+
+#include "EduRTOS_Config.h"
+
+/*Demo is built by CMake only, So it doesn't conflict with main function of microcontroller projects.*/
+#ifdef EduRTOS_CMAKE_BUILD
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "EduRTOS.h"
+#include "Port/port.h"
+
+#define ITERATIONS			200000
+#define MAILBOX_MESSAGES	30
+#define DELAY_ROUNDS		10
+#define POOL_BLOCKS			4
+/*Maximum number of ticks that checker waits scenario tasks.*/
+#define SCENARIO_TIMEOUT	1000
+
+Mutex exampleMutex;
+Semaphore exampleSemaphore;
+MailBox exampleMailbox;
+Edu_u32 MailboxArray[10];
+MemoryPool examplePool;
+Edu_u32 PoolBuffer[POOL_BLOCKS * 4];
+Mutex inheritanceMutex;
+Mutex ceilingMutexHigh;
+Mutex ceilingMutexLow;
+Semaphore scenarioSemaphore;
+#if EduRTOS_Config_USE_EVENT_GROUP
+EventGroup scenarioEventGroup;
+#endif
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+SoftwareTimer oneShotTimer;
+SoftwareTimer autoReloadTimer;
+volatile Edu_u32 oneShotExpirations = 0;
+volatile Edu_u32 autoReloadExpirations = 0;
+Edu_Bool isEarlyTimerStartRejected = Edu_False;
+#endif
+
+volatile Edu_u32 mutexSharedResource = 6954;
+volatile Edu_u32 semaphoreSharedResource = 6954;
+volatile Edu_u32 mailboxReceivedInOrder = 0;
+volatile Edu_u32 delayedRounds = 0;
+volatile Edu_u32 finishedTasks = 0;
+
+/*Scenario tasks record their steps, So checker compares order of steps with expected order.*/
+char scenarioSteps[16];
+volatile Edu_u32 scenarioLength = 0;
+TaskId scenarioTasks[3];
+
+/*C library functions (like printf) aren't reentrant, so they are called inside critical section.*/
+#define DEMO_PRINT(...)		do{ EduRTOS_EnterCritical(); printf(__VA_ARGS__); fflush(stdout); EduRTOS_ExitCritical(); }while(0)
+
+static void TaskFinished(void){
+	EduRTOS_EnterCritical();
+	finishedTasks++;
+	EduRTOS_ExitCritical();
+	/*Stack of task is returned to stack region.*/
+	(void)EduRTOS_TaskDelete(EduRTOS_GetCurrentRunningTask());
+}
+
+static void Task_MutexIncrement(void){
+	for (Edu_u32 i = 0; i<ITERATIONS; i++){
+		MutexLock(&exampleMutex, EduRTOS_INFINITE);
+		mutexSharedResource++;
+		MutexRelease(&exampleMutex, EduRTOS_INFINITE);
+	}
+	TaskFinished();
+}
+
+static void Task_MutexDecrement(void){
+	for (Edu_u32 i = 0; i<ITERATIONS; i++){
+		MutexLock(&exampleMutex, EduRTOS_INFINITE);
+		mutexSharedResource--;
+		MutexRelease(&exampleMutex, EduRTOS_INFINITE);
+	}
+	TaskFinished();
+}
+
+static void Task_SemaphoreIncrement(void){
+	for (Edu_u32 i = 0; i<ITERATIONS; i++){
+		SemaphoreTake(&exampleSemaphore, EduRTOS_INFINITE);
+		semaphoreSharedResource++;
+		SemaphoreGive(&exampleSemaphore, EduRTOS_INFINITE);
+	}
+	TaskFinished();
+}
+
+static void Task_SemaphoreDecrement(void){
+	for (Edu_u32 i = 0; i<ITERATIONS; i++){
+		SemaphoreTake(&exampleSemaphore, EduRTOS_INFINITE);
+		semaphoreSharedResource--;
+		SemaphoreGive(&exampleSemaphore, EduRTOS_INFINITE);
+	}
+	TaskFinished();
+}
+
+static void Task_MailboxWriter(void){
+	for (Edu_u32 i = 0; i<MAILBOX_MESSAGES; i++){
+		MailBoxWrite(&exampleMailbox, i, EduRTOS_INFINITE);
+	}
+	TaskFinished();
+}
+
+static void Task_MailboxReader(void){
+	Edu_u32 tempValue;
+	for (Edu_u32 i = 0; i<MAILBOX_MESSAGES; i++){
+		if ((EduRTOS_Mailbox_ReadSucceed == MailBoxRead(&exampleMailbox, &tempValue, EduRTOS_INFINITE)) && (tempValue == i)){
+			mailboxReceivedInOrder++;
+		}
+	}
+	TaskFinished();
+}
+
+static void Task_Delayed(void){
+	for (Edu_u32 i = 0; i<DELAY_ROUNDS; i++){
+		/*Wait 20ms*/
+		EduRTOS_TaskDelayUntil(EduRTOS_TicksToMs(20));
+		delayedRounds++;
+	}
+	TaskFinished();
+}
+
+/*
+ * Scenarios run after examples, Their tasks are FIFO (not time sliced), So their steps order depends only on priorities.
+ * Tasks suspend themselves first, and they are resumed when they are needed.
+ * */
+static void Scenario_Step(const char Step){
+	EduRTOS_EnterCritical();
+	if (scenarioLength < (sizeof(scenarioSteps) - 1)){
+		scenarioSteps[scenarioLength++] = Step;
+	}
+	EduRTOS_ExitCritical();
+}
+
+static void Scenario_SuspendSelf(void){
+	EduRTOS_TaskSuspend(EduRTOS_GetCurrentRunningTask());
+}
+
+static void Scenario_Exit(void){
+	(void)EduRTOS_TaskDelete(EduRTOS_GetCurrentRunningTask());
+}
+
+static TaskId Scenario_CreateTask(void (* const TaskFunction)(void), const Edu_u32 Priority){
+	return EduRTOS_CreateTaskWithPolicy(TaskFunction, Priority, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL,
+			EduTask_SchedPolicy_FIFO, EduRTOS_TIME_SLICE_BY_PRIORITY);
+}
+
+/*Task that only records its step, Its priority decides when it runs.*/
+static void Scenario_StepTask(const Edu_u32 Step, const Edu_u32 IsSuspended){
+	if (Edu_True == IsSuspended){
+		Scenario_SuspendSelf();
+	}
+	Scenario_Step((char)Step);
+	Scenario_Exit();
+}
+
+/* @brief  			   --> Create task that records one step.
+ * @param  Step 	   --> Letter of step.
+ * @param  Priority    --> Priority of task.
+ * @param  IsSuspended --> Edu_True if task suspends itself till it's resumed, Otherwise it records step once it runs.
+ * @retval --> Id of created task.
+ * */
+static TaskId Scenario_CreateStepTask(const char Step, const Edu_u32 Priority, const Edu_Bool IsSuspended){
+	TaskParameters Parameters = {0};
+	Parameters.arg1_32bit = (Edu_u32)Step;
+	Parameters.arg2_32bit = (Edu_u32)IsSuspended;
+	return EduRTOS_CreateTaskWithPolicy(Scenario_StepTask, Priority, EduRTOS_Config_TASK_MIN_STACK_SIZE, &Parameters,
+			EduTask_SchedPolicy_FIFO, EduRTOS_TIME_SLICE_BY_PRIORITY);
+}
+
+/* @brief  				 --> Wait till tasks of scenario delete themselves, Checker is blocked meanwhile so they run.
+ * @param  NumberOfTasks --> Number of tasks before scenario tasks are created.
+ * @param  ExpectedSteps --> Expected order of steps.
+ * @retval --> Edu_True if steps are recorded in expected order.
+ * */
+static Edu_Bool Scenario_Check(const Edu_u32 NumberOfTasks, const char * const ExpectedSteps){
+	for (Edu_u32 Ticks = 0; (NumberOfTasks != EduRTOS_GetNumberOfCreatedTasks()) && (Ticks < SCENARIO_TIMEOUT); Ticks++){
+		EduRTOS_TaskDelayUntil(1);
+	}
+	EduRTOS_EnterCritical();
+	scenarioSteps[scenarioLength] = '\0';
+	const Edu_Bool IsExpected = (0 == strcmp(scenarioSteps, ExpectedSteps)) ? Edu_True : Edu_False;
+	scenarioLength = 0;
+	EduRTOS_ExitCritical();
+	return IsExpected;
+}
+
+/*Medium task (5) is resumed while low task (2) holds mutex that high task (6) waits.*/
+static void Scenario_InheritanceHigh(void){
+	Scenario_SuspendSelf();
+	MutexLock(&inheritanceMutex, EduRTOS_INFINITE);
+	Scenario_Step('H');
+	MutexRelease(&inheritanceMutex, EduRTOS_INFINITE);
+	Scenario_Exit();
+}
+
+static void Scenario_InheritanceLow(void){
+	MutexLock(&inheritanceMutex, EduRTOS_INFINITE);
+	/*High task blocks on mutex, So low task inherits its priority and medium task can't preempt it.*/
+	EduRTOS_TaskResume(scenarioTasks[1]);
+	EduRTOS_TaskResume(scenarioTasks[0]);
+	Scenario_Step('I');
+	/*Mutex is handed over to high task, then medium task runs before low task (its priority is restored).*/
+	MutexRelease(&inheritanceMutex, EduRTOS_INFINITE);
+	Scenario_Step('R');
+	Scenario_Exit();
+}
+
+/*Low task (2) holds two ceiling mutexes (6 and 4), Its priority is restored step by step as they are released.*/
+static void Scenario_CeilingLow(void){
+	MutexLock(&ceilingMutexHigh, EduRTOS_INFINITE);
+	MutexLock(&ceilingMutexLow, EduRTOS_INFINITE);
+	EduRTOS_TaskResume(scenarioTasks[0]);
+	Scenario_Step('a');
+	/*Priority goes down to 4, So task of priority 5 preempts it.*/
+	MutexRelease(&ceilingMutexHigh, EduRTOS_INFINITE);
+	EduRTOS_TaskResume(scenarioTasks[1]);
+	Scenario_Step('b');
+	/*Priority goes down to 2, So task of priority 3 preempts it.*/
+	MutexRelease(&ceilingMutexLow, EduRTOS_INFINITE);
+	Scenario_Step('c');
+	Scenario_Exit();
+}
+
+/*Tasks (6 and 5) are suspended and moved below controller task (4), Then they preempt it only when priorities are changed.
+ * Ready task (1) below controller must not run before changed tasks.*/
+static void Scenario_PriorityController(void){
+	EduRTOS_TaskSetPriority(scenarioTasks[0], 1);
+	EduRTOS_TaskResume(scenarioTasks[0]);
+	if (1 == EduRTOS_TaskGetPriority(scenarioTasks[0])){
+		Scenario_Step('a');
+	}
+	/*Ready task is raised above controller, So it preempts it right away.*/
+	EduRTOS_TaskSetPriority(scenarioTasks[0], 6);
+	EduRTOS_TaskSetPriority(scenarioTasks[1], 3);
+	EduRTOS_TaskResume(scenarioTasks[1]);
+	Scenario_Step('b');
+	/*Controller is lowered below ready task, So it's preempted right away.*/
+	EduRTOS_TaskSetPriority(EduRTOS_GetCurrentRunningTask(), 2);
+	if (2 == EduRTOS_TaskGetPriority(EduRTOS_GetCurrentRunningTask())){
+		Scenario_Step('c');
+	}
+	Scenario_Exit();
+}
+
+/* @brief  --> Check raising and lowering priority of ready and running tasks.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_Priority(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	scenarioTasks[0] = Scenario_CreateStepTask('X', 6, Edu_True);
+	scenarioTasks[1] = Scenario_CreateStepTask('Z', 5, Edu_True);
+	(void)Scenario_CreateStepTask('L', 1, Edu_False);
+	(void)Scenario_CreateTask(Scenario_PriorityController, 4);
+	return Scenario_Check(NumberOfTasks, "aXbZcL");
+}
+
+/*Task (6) is suspended while it waits semaphore, So semaphore isn't given to it, and it runs right away once it's resumed (before ready task of priority 1).*/
+static void Scenario_SuspendedWaiter(void){
+	if (EduRTOS_StdType_Status_Timeout == SemaphoreTake(&scenarioSemaphore, EduRTOS_INFINITE)){
+		Scenario_Step('T');
+	}
+	if (EduRTOS_StdType_Status_Succeed == SemaphoreTake(&scenarioSemaphore, 0)){
+		Scenario_Step('k');
+	}
+	Scenario_Exit();
+}
+
+static void Scenario_Suspender(void){
+	EduRTOS_TaskSuspend(scenarioTasks[0]);
+	Scenario_Step('s');
+	SemaphoreGive(&scenarioSemaphore, EduRTOS_INFINITE);
+	EduRTOS_TaskResume(scenarioTasks[0]);
+	Scenario_Step('e');
+	Scenario_Exit();
+}
+
+/* @brief  --> Check suspension of blocked task and resume of higher priority task.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_SuspendResume(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	scenarioTasks[0] = Scenario_CreateTask(Scenario_SuspendedWaiter, 6);
+	(void)Scenario_CreateStepTask('L', 1, Edu_False);
+	(void)Scenario_CreateTask(Scenario_Suspender, 2);
+	return Scenario_Check(NumberOfTasks, "sTkeL");
+}
+
+/*Controller (4) gives semaphore as interrupt handler to waiter (6), Then it yields again with the same flag
+ * after waiter is finished, and ready task (1) must not preempt it.*/
+static void Scenario_IsrWaiter(void){
+	if (EduRTOS_StdType_Status_Succeed == SemaphoreTake(&scenarioSemaphore, EduRTOS_INFINITE)){
+		Scenario_Step('W');
+	}
+	Scenario_Exit();
+}
+
+static void Scenario_IsrController(void){
+	Edu_Bool HigherPriorityTaskWoken = Edu_False;
+	(void)SemaphoreGiveFromISR(&scenarioSemaphore, &HigherPriorityTaskWoken);
+	Scenario_Step('a');
+	EduRTOS_YieldFromISR(HigherPriorityTaskWoken);
+	Scenario_Step('b');
+	/*Flag is stale, Woken task is already finished.*/
+	EduRTOS_YieldFromISR(HigherPriorityTaskWoken);
+	Scenario_Step('c');
+	Scenario_Exit();
+}
+
+/* @brief  --> Check that yield from interrupt switches to woken task only while it's higher than current task.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_YieldFromISR(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	(void)Scenario_CreateTask(Scenario_IsrWaiter, 6);
+	(void)Scenario_CreateStepTask('L', 1, Edu_False);
+	(void)Scenario_CreateTask(Scenario_IsrController, 4);
+	return Scenario_Check(NumberOfTasks, "aWbcL");
+}
+
+/* @brief  --> Check priority inheritance, priority ceiling and restore of priority of nested mutexes.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_MutexProtocols(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	scenarioTasks[0] = Scenario_CreateStepTask('X', 5, Edu_True);
+	scenarioTasks[1] = Scenario_CreateTask(Scenario_InheritanceHigh, 6);
+	(void)Scenario_CreateTask(Scenario_InheritanceLow, 2);
+	const Edu_Bool IsInherited = Scenario_Check(NumberOfTasks, "IHXR");
+
+	scenarioTasks[0] = Scenario_CreateStepTask('X', 5, Edu_True);
+	scenarioTasks[1] = Scenario_CreateStepTask('Y', 3, Edu_True);
+	(void)Scenario_CreateTask(Scenario_CeilingLow, 2);
+	const Edu_Bool IsCeilingRestored = Scenario_Check(NumberOfTasks, "aXbYc");
+	return ((Edu_True == IsInherited) && (Edu_True == IsCeilingRestored)) ? Edu_True : Edu_False;
+}
+
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+/*Receiver (6) is notified with bits while it waits, and it counts notifications that are sent while it's suspended.*/
+static void Scenario_NotificationReceiver(void){
+	Edu_u32 Value;
+	if (0 == EduRTOS_TaskNotifyTake(Edu_True, 2)){
+		Scenario_Step('t');
+	}
+	if ((EduRTOS_StdType_Status_Succeed == EduRTOS_TaskNotifyWait(0, 0xFFFFFFFF, &Value, EduRTOS_INFINITE)) && (0x5 == Value)){
+		Scenario_Step('w');
+	}
+	Scenario_SuspendSelf();
+	if (2 == EduRTOS_TaskNotifyTake(Edu_False, 0)){
+		Scenario_Step('2');
+	}
+	if (1 == EduRTOS_TaskNotifyTake(Edu_True, 0)){
+		Scenario_Step('1');
+	}
+	Scenario_Exit();
+}
+
+static void Scenario_NotificationSender(void){
+	/*Receiver waits notification after its first take times out.*/
+	EduRTOS_TaskDelayUntil(5);
+	(void)EduRTOS_TaskNotify(scenarioTasks[0], 0x5, EduTask_Notify_SetBits);
+	Scenario_Step('s');
+	(void)EduRTOS_TaskNotify(scenarioTasks[0], 0, EduTask_Notify_Increment);
+	(void)EduRTOS_TaskNotify(scenarioTasks[0], 0, EduTask_Notify_Increment);
+	EduRTOS_TaskResume(scenarioTasks[0]);
+	Scenario_Step('e');
+	Scenario_Exit();
+}
+
+/* @brief  --> Check timeout, wait with bits and counting take of task notifications.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_Notifications(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	scenarioTasks[0] = Scenario_CreateTask(Scenario_NotificationReceiver, 6);
+	(void)Scenario_CreateTask(Scenario_NotificationSender, 2);
+	return Scenario_Check(NumberOfTasks, "tws21e");
+}
+#endif
+
+#if EduRTOS_Config_USE_EVENT_GROUP
+/*Task (6) waits all of events 0 & 1 and clears them, and task (5) waits any of events 2 & 3 without clearing them.*/
+static void Scenario_EventGroupWaitAll(void){
+	Edu_u32 Events;
+	if ((EduRTOS_StdType_Status_Succeed == EventGroupWait(&scenarioEventGroup, 0x3, Edu_True, Edu_True, &Events, EduRTOS_INFINITE)) &&
+			(0x3 == Events)){
+		Scenario_Step('A');
+	}
+	Scenario_Exit();
+}
+
+static void Scenario_EventGroupWaitAny(void){
+	Edu_u32 Events;
+	if ((EduRTOS_StdType_Status_Succeed == EventGroupWait(&scenarioEventGroup, 0xC, Edu_False, Edu_False, &Events, EduRTOS_INFINITE)) &&
+			(0x8 == Events)){
+		Scenario_Step('B');
+	}
+	Scenario_Exit();
+}
+
+static void Scenario_EventGroupSetter(void){
+	if (EduRTOS_StdType_Status_Timeout == EventGroupWait(&scenarioEventGroup, 0x10, Edu_False, Edu_False, EduRTOS_NULL, 2)){
+		Scenario_Step('t');
+	}
+	/*One of two events doesn't wake up task that waits all of them.*/
+	(void)EventGroupSet(&scenarioEventGroup, 0x1);
+	Scenario_Step('1');
+	(void)EventGroupSet(&scenarioEventGroup, 0x2);
+	if (0 == EventGroupGet(&scenarioEventGroup)){
+		Scenario_Step('0');
+	}
+	(void)EventGroupSet(&scenarioEventGroup, 0x8);
+	if (0x8 == EventGroupGet(&scenarioEventGroup)){
+		Scenario_Step('8');
+	}
+	(void)EventGroupClear(&scenarioEventGroup, 0x8);
+	Scenario_Exit();
+}
+
+/* @brief  --> Check wait all, wait any and timeout of event group, and NULL event group.
+ * @retval --> Edu_True if all steps are in expected order.
+ * */
+static Edu_Bool Check_EventGroup(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	(void)Scenario_CreateTask(Scenario_EventGroupWaitAll, 6);
+	(void)Scenario_CreateTask(Scenario_EventGroupWaitAny, 5);
+	(void)Scenario_CreateTask(Scenario_EventGroupSetter, 2);
+	const Edu_Bool IsWaitPassed = Scenario_Check(NumberOfTasks, "t1A0B8");
+	/*NULL event group is rejected like other objects (It doesn't halt).*/
+	const Edu_Bool IsNullRejected = ((0 == EventGroupSet(EduRTOS_NULL, 0x1)) && (0 == EventGroupGet(EduRTOS_NULL)) &&
+			(EduRTOS_StdType_Status_Fail == EventGroupWait(EduRTOS_NULL, 0x1, Edu_False, Edu_False, EduRTOS_NULL, 0))) ? Edu_True : Edu_False;
+	return ((Edu_True == IsWaitPassed) && (Edu_True == IsNullRejected)) ? Edu_True : Edu_False;
+}
+#endif
+
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+/*Context of timer is its expirations counter.*/
+static void Demo_TimerCallback(SoftwareTimer * const Timer){
+	(*(volatile Edu_u32 *)Timer->Context)++;
+}
+
+/* @brief  --> Check one-shot and auto-reload timers, and that stopped timer (or timer started before EduRTOS_Init) doesn't expire.
+ * @retval --> Edu_True if numbers of expirations are expected.
+ * */
+static Edu_Bool Check_SoftwareTimers(void){
+	(void)SoftwareTimerInit(&oneShotTimer, Demo_TimerCallback, 5, Edu_False, (void *)&oneShotExpirations);
+	(void)SoftwareTimerInit(&autoReloadTimer, Demo_TimerCallback, 3, Edu_True, (void *)&autoReloadExpirations);
+	(void)SoftwareTimerStart(&oneShotTimer);
+	(void)SoftwareTimerStart(&autoReloadTimer);
+	/*Auto-reload timer expires at 3, 6, ... 18 ticks, and one-shot timer once at 5 ticks.*/
+	EduRTOS_TaskDelayUntil(20);
+	(void)SoftwareTimerStop(&autoReloadTimer);
+	const Edu_u32 AutoReloadExpirations = autoReloadExpirations;
+	const Edu_Bool IsStopped = ((Edu_True != SoftwareTimerIsActive(&oneShotTimer)) &&
+			(Edu_True != SoftwareTimerIsActive(&autoReloadTimer))) ? Edu_True : Edu_False;
+	EduRTOS_TaskDelayUntil(10);
+	return ((1 == oneShotExpirations) && (6 == AutoReloadExpirations) && (AutoReloadExpirations == autoReloadExpirations) &&
+			(Edu_True == IsStopped) && (Edu_True == isEarlyTimerStartRejected)) ? Edu_True : Edu_False;
+}
+#endif
+
+#if EduRTOS_Config_USE_TRACE
+/*Trace buffer is printed as hex lines with "EDUTRACE" prefix, So it's dumped through UART of QEMU too.*/
+static void Demo_TraceWrite(const void *Data, Edu_u32 Size){
+	const Edu_u8 *Bytes = (const Edu_u8 *)Data;
+	for (Edu_u32 i = 0; i < Size; i++){
+		if (0 == (i % 32)){
+			printf("%sEDUTRACE ", (0 == i) ? "" : "\n");
+		}
+		printf("%02x", Bytes[i]);
+	}
+	printf("\n");
+}
+#endif
+
+static void Task_Checker(void){
+	const Edu_u32 NumberOfTasks = EduRTOS_GetNumberOfCreatedTasks();
+	/*Finished tasks delete themselves.*/
+	while ((7 != finishedTasks) || ((NumberOfTasks - 7) != EduRTOS_GetNumberOfCreatedTasks())){
+		EduRTOS_TaskDelayUntil(EduRTOS_TicksToMs(100));
+	}
+	const Edu_Bool IsPriorityPassed = Check_Priority();
+	const Edu_Bool IsSuspendResumePassed = Check_SuspendResume();
+	const Edu_Bool IsYieldFromISRPassed = Check_YieldFromISR();
+	const Edu_Bool IsMutexProtocolsPassed = Check_MutexProtocols();
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+	const Edu_Bool IsNotificationsPassed = Check_Notifications();
+#else
+	const Edu_Bool IsNotificationsPassed = Edu_True;
+#endif
+#if EduRTOS_Config_USE_EVENT_GROUP
+	const Edu_Bool IsEventGroupPassed = Check_EventGroup();
+#else
+	const Edu_Bool IsEventGroupPassed = Edu_True;
+#endif
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+	const Edu_Bool IsSoftwareTimersPassed = Check_SoftwareTimers();
+#else
+	const Edu_Bool IsSoftwareTimersPassed = Edu_True;
+#endif
+
+	/*All blocks are allocated, Then allocation fails after timeout and blocks are freed.*/
+	void *Blocks[POOL_BLOCKS];
+	for (Edu_u32 i = 0; i < POOL_BLOCKS; i++){
+		Blocks[i] = MemoryPoolAllocate(&examplePool, 0);
+	}
+	const Edu_Bool IsPoolEmpty = (EduRTOS_NULL == MemoryPoolAllocate(&examplePool, 2)) ? Edu_True : Edu_False;
+	for (Edu_u32 i = 0; i < POOL_BLOCKS; i++){
+		(void)MemoryPoolFree(&examplePool, Blocks[i]);
+	}
+	/*Block that is already free isn't linked in free list again.*/
+	const Edu_Bool IsPoolDoubleFreeRejected = (EduRTOS_StdType_Status_Fail == MemoryPoolFree(&examplePool, Blocks[0])) ? Edu_True : Edu_False;
+	MemoryPoolStats PoolStats;
+	(void)MemoryPoolGetStats(&examplePool, &PoolStats);
+
+	/*Blocks of different sizes are freed out of order, Then they are merged again.
+	 * Block that is already merged into free block and address inside block aren't freed.*/
+	void * const Frame = EduRTOS_HeapAllocate(100);
+	void * const LargeFrame = EduRTOS_HeapAllocate(1000);
+	void * const LastFrame = EduRTOS_HeapAllocate(64);
+	(void)EduRTOS_HeapFree(Frame);
+	(void)EduRTOS_HeapFree(LargeFrame);
+	const Edu_Bool IsHeapMisuseRejected = ((EduRTOS_StdType_Status_Fail == EduRTOS_HeapFree(LargeFrame)) &&
+			(EduRTOS_StdType_Status_Fail == EduRTOS_HeapFree((Edu_u8 *)LastFrame + EduRTOS_HEAP_ALIGNMENT))) ? Edu_True : Edu_False;
+	(void)EduRTOS_HeapFree(LastFrame);
+	EduRTOS_HeapStats HeapStats;
+	(void)EduRTOS_HeapGetStats(&HeapStats);
+	/*Reported largest block can be allocated.*/
+	void * const LargestBlock = EduRTOS_HeapAllocate(HeapStats.LargestFreeBlock);
+	(void)EduRTOS_HeapFree(LargestBlock);
+
+	/*Stacks of deleted tasks are adjacent, So they are merged into one free block.*/
+	const Edu_u32 FreeStackSize = EduRTOS_GetFreeStackRegionSize();
+	const Edu_u32 LargestStackBlock = EduRTOS_GetLargestFreeStackBlock();
+#if EduRTOS_Config_TASK_STACKS_FROM_HEAP
+	/*Largest stack is rounded down to size range of heap.*/
+	const Edu_Bool IsStackRegionMerged = (0 == HeapStats.FragmentationPercent) ? Edu_True : Edu_False;
+#else
+	const Edu_Bool IsStackRegionMerged = (FreeStackSize == LargestStackBlock) ? Edu_True : Edu_False;
+#endif
+	const Edu_Bool IsPassed = (6954 == mutexSharedResource) && (6954 == semaphoreSharedResource) && (Edu_True == IsMutexProtocolsPassed) &&
+			(Edu_True == IsSuspendResumePassed) &&
+			(Edu_True == IsYieldFromISRPassed) &&
+			(Edu_True == IsPriorityPassed) &&
+			(Edu_True == IsNotificationsPassed) && (Edu_True == IsEventGroupPassed) &&
+			(Edu_True == IsSoftwareTimersPassed) &&
+			(MAILBOX_MESSAGES == mailboxReceivedInOrder) && (DELAY_ROUNDS == delayedRounds) &&
+			(Edu_True == IsStackRegionMerged) && (Edu_True == IsPoolEmpty) && (0 == PoolStats.UsedBlocks) &&
+			(POOL_BLOCKS == PoolStats.PeakUsedBlocks) && (1 == PoolStats.FailedAllocations) &&
+			(Edu_True == IsPoolDoubleFreeRejected) &&
+			(EduRTOS_NULL != Frame) && (EduRTOS_NULL != LargeFrame) && (EduRTOS_NULL != LastFrame) &&
+			(Edu_True == IsHeapMisuseRejected) && (EduRTOS_NULL != LargestBlock) && (0 == HeapStats.FragmentationPercent);
+
+	DEMO_PRINT("Mutex shared resource     : %lu\n", (unsigned long)mutexSharedResource);
+	DEMO_PRINT("Mutex priority protocols  : %s\n", (Edu_True == IsMutexProtocolsPassed) ? "OK" : "FAILED");
+	DEMO_PRINT("Semaphore shared resource : %lu\n", (unsigned long)semaphoreSharedResource);
+	DEMO_PRINT("Task notifications        : %s\n", (Edu_True == IsNotificationsPassed) ? "OK" : "FAILED");
+	DEMO_PRINT("Event group               : %s\n", (Edu_True == IsEventGroupPassed) ? "OK" : "FAILED");
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+	DEMO_PRINT("Software timers           : %s\n", (Edu_True == IsSoftwareTimersPassed) ? "OK" : "FAILED");
+#endif
+	DEMO_PRINT("Mailbox messages in order : %lu\n", (unsigned long)mailboxReceivedInOrder);
+	DEMO_PRINT("Delayed rounds            : %lu\n", (unsigned long)delayedRounds);
+	DEMO_PRINT("Ticks                     : %lu\n", (unsigned long)EduRTOS_GetCurrentTickNumber());
+	DEMO_PRINT("Set priority              : %s\n", (Edu_True == IsPriorityPassed) ? "OK" : "FAILED");
+	DEMO_PRINT("Suspend and resume        : %s\n", (Edu_True == IsSuspendResumePassed) ? "OK" : "FAILED");
+	DEMO_PRINT("Yield from interrupt      : %s\n", (Edu_True == IsYieldFromISRPassed) ? "OK" : "FAILED");
+	DEMO_PRINT("Free stack region         : %lu bytes, largest block %lu bytes\n",
+			(unsigned long)FreeStackSize, (unsigned long)LargestStackBlock);
+	DEMO_PRINT("Memory pool               : peak %lu of %lu blocks, %lu failed allocations\n",
+			(unsigned long)PoolStats.PeakUsedBlocks, (unsigned long)PoolStats.NumberOfBlocks, (unsigned long)PoolStats.FailedAllocations);
+	DEMO_PRINT("Heap                      : %lu of %lu bytes free, peak %lu bytes used, %lu%% fragmentation\n",
+			(unsigned long)HeapStats.FreeSize, (unsigned long)HeapStats.TotalSize, (unsigned long)HeapStats.PeakUsedSize,
+			(unsigned long)HeapStats.FragmentationPercent);
+#if EduRTOS_Config_USE_STACK_WATERMARK
+	EduRTOS_StackReport Reports[EduRTOS_Config_MAX_NUMBER_OF_TASKS + 1];
+	const Edu_u32 NumberOfReports = EduRTOS_GetStackReport(Reports, EduRTOS_ArrayLength(Reports));
+	for (Edu_u32 i = 0; i < NumberOfReports; i++){
+		DEMO_PRINT("Task %2lu stack             : %lu of %lu bytes used, suggested %lu bytes%s\n", (unsigned long)Reports[i].Id,
+				(unsigned long)Reports[i].MaxUsed, (unsigned long)Reports[i].StackSize, (unsigned long)Reports[i].SuggestedSize,
+				(Edu_True == Reports[i].IsOverflowed) ? " (OVERFLOWED)" : "");
+	}
+#endif
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	EduRTOS_TaskStats Stats[EduRTOS_Config_MAX_NUMBER_OF_TASKS + 1];
+	const Edu_u32 NumberOfStats = EduRTOS_GetTasksStats(Stats, EduRTOS_ArrayLength(Stats));
+	for (Edu_u32 i = 0; i < NumberOfStats; i++){
+		DEMO_PRINT("Task %2lu (priority %lu)      : %3lu%% CPU, %lu switches\n", (unsigned long)Stats[i].Id,
+				(unsigned long)Stats[i].Priority, (unsigned long)Stats[i].CpuPercentage, (unsigned long)Stats[i].SwitchInCount);
+	}
+	DEMO_PRINT("CPU load                  : %lu%%\n", (unsigned long)EduRTOS_GetCpuLoadPercentage());
+#endif
+#if EduRTOS_Config_USE_TRACE
+	EduRTOS_EnterCritical();
+	EduRTOS_TraceDump(Demo_TraceWrite);
+	fflush(stdout);
+	EduRTOS_ExitCritical();
+#endif
+	DEMO_PRINT("%s\n", IsPassed ? "PASSED" : "FAILED");
+	exit(IsPassed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(void)
+{
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+	/*Timer can't be started before timer service task is created.*/
+	(void)SoftwareTimerInit(&oneShotTimer, Demo_TimerCallback, 5, Edu_False, (void *)&oneShotExpirations);
+	isEarlyTimerStartRejected = (EduRTOS_StdType_Status_Fail == SoftwareTimerStart(&oneShotTimer)) ? Edu_True : Edu_False;
+#endif
+	EduRTOS_Init();
+	MutexInit(&exampleMutex);
+	MutexInit(&inheritanceMutex);
+	MutexInitWithCeiling(&ceilingMutexHigh, 6);
+	MutexInitWithCeiling(&ceilingMutexLow, 4);
+#if EduRTOS_Config_USE_EVENT_GROUP
+	EventGroupInit(&scenarioEventGroup);
+#endif
+	SemaphoreInit(&exampleSemaphore, 1);
+	SemaphoreInit(&scenarioSemaphore, 0);
+	MailBoxInit(&exampleMailbox, MailboxArray, EduRTOS_ArrayLength(MailboxArray));
+	MemoryPoolInit(&examplePool, PoolBuffer, sizeof(PoolBuffer), sizeof(PoolBuffer) / POOL_BLOCKS);
+
+	EduRTOS_CreateTask(Task_Checker, 8, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_Delayed, 7, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_MailboxReader, 6, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_MailboxWriter, 5, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	/*Tasks of each pair share the same priority, So they take turns every time slice.*/
+	EduRTOS_CreateTask(Task_SemaphoreDecrement, 3, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_SemaphoreIncrement, 3, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_MutexDecrement, 1, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	EduRTOS_CreateTask(Task_MutexIncrement, 1, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+	RTOS_Start_Scheduler();
+
+	return EXIT_FAILURE;
+}
+
+#endif
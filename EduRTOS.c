@@ -8,48 +8,49 @@
 
 #include "EduRTOS.h"
 #include "EduRTOS_defines.h"
+#include "Port/port.h"
 
 
-#if EduRTOS_USER_IDLE_TASK
+#if EduRTOS_Config_USER_IDLE_TASK
 void EduRTOS_IdleTaskCallback(void);
 #endif
 
 static void IdleTask(){
 	while(1){
-#if EduRTOS_USER_IDLE_TASK
+		/*Stacks of deleted tasks are returned to stack region (or heap).*/
+		EduRTOS_ReclaimDeletedTasks();
+
+#if EduRTOS_Config_USER_IDLE_TASK
 		EduRTOS_IdleTaskCallback();
 #endif
 
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+		/*Sleep till next wakeup tick if there is no ready task.*/
+		EduRTOS_TicklessIdle();
+#endif
 	}
 }
 
 void EduRTOS_Init(void){
 	/*Disable interrupts.*/
-	__disable_irq();
-
-	SysTick_Config(EduRTOS_SystickReloadTicks);
-
-	/* Set priority levels */
-	NVIC_SetPriority(SVCall_IRQn, 0);
-	NVIC_SetPriority(SysTick_IRQn, 1);
-
-	/* Set PendSV to lowest possible priority */
-	NVIC_SetPriority(PendSV_IRQn, 0xFF);
+	EduRTOS_EnterCritical();
 
-	/* Enable SVC and PendSV interrupts */
-	NVIC_EnableIRQ(PendSV_IRQn);
-	NVIC_EnableIRQ(SVCall_IRQn);
+	/*Interrupts priorities, Tick timer is started by RTOS_Start_Scheduler.*/
+	EduRTOS_Port_Init();
 
 	/*Enable interrupts.*/
-	__enable_irq();
+	EduRTOS_ExitCritical();
 
 	/*Create Idle task which has 0 priority (Lowest priority)*/
 	EduRTOS_CreateTask(IdleTask, 0, EduRTOS_Config_TASK_MIN_STACK_SIZE, EduRTOS_NULL);
+
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+	/*Create timer service task which runs callbacks of software timers.*/
+	SoftwareTimerServiceInit();
+#endif
 }
 
 void EduRTOS_ErrorHandler(void){
-	__disable_irq();
-	while(1){
-
-	}
+	/*Mask kernel interrupts and stop.*/
+	EduRTOS_Port_Halt();
 }
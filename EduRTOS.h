@@ -36,6 +36,31 @@
 #include "Mailbox/mailbox.h"
 #endif
 
+
+#if EduRTOS_Config_USE_EVENT_GROUP
+#include "EventGroup/eventgroup.h"
+#endif
+
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+#include "MemoryPool/memorypool.h"
+#endif
+
+
+#if EduRTOS_Config_USE_HEAP
+#include "Heap/heap.h"
+#endif
+
+
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+#include "Timer/timer.h"
+#endif
+
+
+#if EduRTOS_Config_USE_TRACE
+#include "Trace/trace.h"
+#endif
+
 /*
 ==================================================
   End Section --> File Includes
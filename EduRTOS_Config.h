@@ -10,8 +10,69 @@
 #ifndef EDUCATIONALRTOS_EDURTOS_CONFIG_H_
 #define EDUCATIONALRTOS_EDURTOS_CONFIG_H_
 
+/*
+==================================================
+  Start Section --> Port Configurations
+==================================================
+ */
+
+#define 	EduRTOS_PORT_ARM_CM4						1
+#define 	EduRTOS_PORT_POSIX							2
+
+/*
+ * Target that EduRTOS runs on, EduRTOS_PORT_ARM_CM4 for Cortex-M4 microcontrollers, or
+ * EduRTOS_PORT_POSIX to run EduRTOS as Linux process (for testing and benchmarking).
+ * It may be defined by build system instead.
+ * */
+#ifndef EduRTOS_Config_PORT
+#define 	EduRTOS_Config_PORT							EduRTOS_PORT_ARM_CM4
+#endif
+
+#define 	EduRTOS_BOARD_STM32F401CC					1
+#define 	EduRTOS_BOARD_MPS2_AN386					2
+
+/*
+ * Board of ARM Cortex-M4 port, It selects CMSIS device header, memory and clock.
+ * EduRTOS_BOARD_MPS2_AN386 is Cortex-M4 machine of QEMU (qemu-system-arm -M mps2-an386).
+ * It may be defined by build system instead.
+ * */
+#ifndef EduRTOS_Config_BOARD
+#define 	EduRTOS_Config_BOARD						EduRTOS_BOARD_STM32F401CC
+#endif
+
+#if EduRTOS_Config_PORT == EduRTOS_PORT_ARM_CM4
+#if EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+/*CMSIS generic Cortex-M4 (with FPU) device header.*/
+#include "ARMCM4_FP.h"
+#else
 /*Include CMSIS Library here, replace "stm32f401xc.h" with other file is needed.*/
 #include "stm32f401xc.h"
+#endif
+#endif
+/*
+==================================================
+  End Section --> Port Configurations
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Interrupt Configurations
+==================================================
+ */
+
+/*
+ * Highest NVIC priority (lowest number) of interrupts that call EduRTOS APIs (ARM Cortex-M4 port only).
+ * Kernel critical sections mask only interrupts of this priority and lower (BASEPRI), So interrupts of higher priority
+ * (0 to this value - 1) are never delayed by kernel, but they must not call EduRTOS APIs.
+ * It must be from 1 to (2^__NVIC_PRIO_BITS - 1), Tick and context switching interrupts run at the lowest priority.
+ * */
+#define 	EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY	5
+/*
+==================================================
+  End Section --> Interrupt Configurations
+==================================================
+ */
 
 /*
 ==================================================
@@ -19,7 +80,22 @@
 ==================================================
  */
 
+/*Number of TCBs (idle task has its own one), It may be defined by build system.*/
+#ifndef EduRTOS_Config_MAX_NUMBER_OF_TASKS
 #define 	EduRTOS_Config_MAX_NUMBER_OF_TASKS			10
+#endif
+
+/*
+ * Highest priority of tasks, Priorities are from 1 to this value (0 is idle task priority).
+ * Any number of tasks may have the same priority, So it's independent of EduRTOS_Config_MAX_NUMBER_OF_TASKS.
+ * */
+#define 	EduRTOS_Config_MAX_PRIORITY					10
+
+/*
+ * Time slice (in ticks) of round-robin tasks created by EduRTOS_CreateTask, When it's over task goes to tail of
+ * ready list of its priority. EduRTOS_TIME_SLICE_BY_PRIORITY gives each task (priority + 1) ticks.
+ * */
+#define 	EduRTOS_Config_TIME_SLICE_TICKS				EduRTOS_TIME_SLICE_BY_PRIORITY
 
 /*
  * To use Idle task callback function user defined, It must has the same following name
@@ -39,11 +115,63 @@
 ==================================================
  */
 
+#if EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+/*Top of 4Mb SSRAM2/3 of mps2-an386.*/
+#define		EduRTOS_Config_OS_STACK_TOP				0x20400000
+#else
 #define		EduRTOS_Config_OS_STACK_TOP				0x20010000
+#endif
 #define 	EduRTOS_Config_OS_STACK_SIZE				(5*1024) // 5Kb
 
 
 #define 	EduRTOS_Config_TASK_MIN_STACK_SIZE			(1024) 	// 1Kb
+
+/*
+ * TLSF heap gives variable size blocks in bounded time (EduRTOS_HeapAllocate & EduRTOS_HeapFree).
+ * Its region is below tasks stack region (ARM Cortex-M4 port), POSIX port reserves its own region.
+ * */
+#define 	EduRTOS_Config_USE_HEAP						1
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+/*Stacks of POSIX port are at least 64Kb.*/
+#define 	EduRTOS_Config_HEAP_SIZE					(1024*1024)	// 1Mb
+#elif EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+#define 	EduRTOS_Config_HEAP_SIZE					(256*1024)	// 256Kb
+#else
+#define 	EduRTOS_Config_HEAP_SIZE					(8*1024)	// 8Kb
+#endif
+
+/*
+ * When it's 1, tasks stacks are allocated from heap instead of tasks stack region, So heap and stacks share the same memory.
+ * It requires EduRTOS_Config_USE_HEAP. It may be defined by build system.
+ * */
+#ifndef EduRTOS_Config_TASK_STACKS_FROM_HEAP
+#define 	EduRTOS_Config_TASK_STACKS_FROM_HEAP		0
+#endif
+
+/*
+ * Size of memory region below OS stack that tasks stacks are allocated from (ARM Cortex-M4 port),
+ * Stacks of deleted tasks are returned to it. POSIX port reserves its own region.
+ * */
+#if EduRTOS_Config_TASK_STACKS_FROM_HEAP
+/*Heap is placed directly below OS stack.*/
+#define 	EduRTOS_Config_TASKS_STACK_REGION_SIZE		0
+#elif EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+#define 	EduRTOS_Config_TASKS_STACK_REGION_SIZE		(256*1024)	// 256Kb
+#else
+#define 	EduRTOS_Config_TASKS_STACK_REGION_SIZE		(32*1024)	// 32Kb
+#endif
+
+/*
+ * When stack watermark is used, stack of each task is filled with known pattern at its creation, So maximum stack
+ * usage (high water mark) is found by EduRTOS_GetTaskStackHighWaterMark and EduRTOS_GetStackReport.
+ * It may be defined by build system.
+ * */
+#ifndef EduRTOS_Config_USE_STACK_WATERMARK
+#define 	EduRTOS_Config_USE_STACK_WATERMARK			0
+#endif
+
+/*Safety margin (percent of high water mark) that is added to suggested stack size of stack report.*/
+#define 	EduRTOS_Config_STACK_MARGIN_PERCENT			25
 /*
 ==================================================
   End Section --> Memory Configurations
@@ -56,7 +184,11 @@
 ==================================================
  */
 
+#if EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+#define 	EduRTOS_Config_CLOCK_HZ			25000000
+#else
 #define 	EduRTOS_Config_CLOCK_HZ			16000000
+#endif
 #define 	EduRTOS_Config_Systick_RATE_ms	10
 /*
 ==================================================
@@ -64,6 +196,74 @@
 ==================================================
  */
 
+/*
+==================================================
+  Start Section --> Low Power Configurations
+==================================================
+ */
+
+/*
+ * When tickless idle is used and idle task is the only ready task, SysTick is reprogrammed to
+ * wake up at next wakeup tick of delayed tasks, processor sleeps (WFI) and missed ticks are added on wake up.
+ * */
+#define 	EduRTOS_Config_USE_TICKLESS_IDLE			0
+
+/*Minimum number of idle ticks to enter sleep, shorter idle periods aren't worth reprogramming SysTick.*/
+#define 	EduRTOS_Config_TICKLESS_MIN_IDLE_TICKS		2
+/*
+==================================================
+  End Section --> Low Power Configurations
+==================================================
+ */
+
+
+/*
+==================================================
+  Start Section --> Trace Configurations
+==================================================
+ */
+
+/*
+ * When trace is used, kernel events (context switching, blocking, unblocking) are recorded with timestamps
+ * in ring buffer "EduRTOS_TraceBuffer", Buffer is decoded on host by "Trace/trace_decode.py".
+ * It may be defined by build system.
+ * */
+#ifndef EduRTOS_Config_USE_TRACE
+#define 	EduRTOS_Config_USE_TRACE					0
+#endif
+
+/*Number of records in trace buffer (8 bytes each), It must be power of 2. Oldest records are overwritten.*/
+#define 	EduRTOS_Config_TRACE_BUFFER_SIZE			256
+/*
+==================================================
+  End Section --> Trace Configurations
+==================================================
+ */
+
+
+/*
+==================================================
+  Start Section --> Statistics Configurations
+==================================================
+ */
+
+/*
+ * When runtime statistics are used, Run time (in port timestamp counts) and number of switching in of each task
+ * are accumulated at every context switching, and they are read by EduRTOS_GetTasksStats.
+ * It may be defined by build system.
+ * */
+#ifndef EduRTOS_Config_USE_RUNTIME_STATS
+#define 	EduRTOS_Config_USE_RUNTIME_STATS			0
+#endif
+
+/*Port timestamp (EduRTOS_Port_Timestamp) is used by trace and runtime statistics.*/
+#define 	EduRTOS_USE_PORT_TIMESTAMP					(EduRTOS_Config_USE_TRACE || EduRTOS_Config_USE_RUNTIME_STATS)
+/*
+==================================================
+  End Section --> Statistics Configurations
+==================================================
+ */
+
 
 /*
 ==================================================
@@ -75,6 +275,21 @@
 #define 	EduRTOS_Config_USE_SEMAPHORE	1
 #define 	EduRTOS_Config_USE_MAILBOX		1
 
+/*
+ * When task notifications are used, each TCB holds 32-bit notification value that other tasks and interrupts
+ * update directly (EduRTOS_TaskNotify), So task is signalled without separate kernel object.
+ * */
+#define 	EduRTOS_Config_USE_TASK_NOTIFICATION	1
+
+/*Event groups let task wait any or all of 32 events (bits) that are set by other tasks and interrupts.*/
+#define 	EduRTOS_Config_USE_EVENT_GROUP	1
+
+/*Memory pools give fixed size blocks from buffer of application in constant time, Task may wait till block is freed.*/
+#define 	EduRTOS_Config_USE_MEMORY_POOL	1
+
+/*Maximum number of blocks of memory pool, Each pool has one bit for each block, So block that is freed twice is rejected.*/
+#define 	EduRTOS_Config_MEMORY_POOL_MAX_BLOCKS	128
+
 /*As Mailbox uses semaphore*/
 #if (EduRTOS_Config_USE_MAILBOX == 1) && (EduRTOS_Config_USE_SEMAPHORE == 0)
 #define 	EduRTOS_Config_USE_SEMAPHORE	1
@@ -86,6 +301,40 @@
  */
 
 
+/*
+==================================================
+  Start Section --> Timer Configurations
+==================================================
+ */
+
+/*
+ * When software timers are used, Callbacks of all one-shot and auto-reload timers run in one timer service task
+ * that is created by EduRTOS_Init, So periodic jobs don't need task (and stack) each.
+ * Service task shares its priority with application tasks (It doesn't reserve priority level), So it's used by default.
+ * It costs one TCB and "EduRTOS_Config_TIMER_TASK_STACK_SIZE", Define it with 0 if timers aren't used.
+ * It may be defined by build system.
+ * */
+#ifndef EduRTOS_Config_USE_SOFTWARE_TIMER
+#define 	EduRTOS_Config_USE_SOFTWARE_TIMER			1
+#endif
+
+/*Priority of timer service task, It may be shared by application tasks (callbacks of timers run in turns with them).*/
+#define 	EduRTOS_Config_TIMER_TASK_PRIORITY			EduRTOS_Config_MAX_PRIORITY
+
+/*Stack of timer service task, All timer callbacks run on it.*/
+#define 	EduRTOS_Config_TIMER_TASK_STACK_SIZE		EduRTOS_Config_TASK_MIN_STACK_SIZE
+
+/*Timer service task sleeps on its task notification.*/
+#if (EduRTOS_Config_USE_SOFTWARE_TIMER == 1) && (EduRTOS_Config_USE_TASK_NOTIFICATION == 0)
+#error "Software timers require EduRTOS_Config_USE_TASK_NOTIFICATION"
+#endif
+/*
+==================================================
+  End Section --> Timer Configurations
+==================================================
+ */
+
+
 
 
 
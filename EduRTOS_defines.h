@@ -14,6 +14,7 @@
   Start Section --> File Includes
 ==================================================
  */
+#include <stdint.h>
 #include "EduRTOS_Config.h"
 /*
 ==================================================
@@ -42,8 +43,11 @@
  */
 
 
-#define 	EduRTOS_TASKS_STACK_TOP				(EduRTOS_Config_OS_STACK_TOP-EduRTOS_Config_OS_STACK_SIZE)
 #define		EduRTOS_IDLE_TASK					EduRTOS_Config_MAX_NUMBER_OF_TASKS
+/*Time slice of task follows its (effective) priority, It runs for (priority + 1) ticks.*/
+#define		EduRTOS_TIME_SLICE_BY_PRIORITY		0
+/*Unused stack words hold this pattern (Stack watermark only).*/
+#define		EduRTOS_STACK_FILL_PATTERN			0xA5A5A5A5UL
 /*
 ==================================================
   Start Section --> Data Type Declaration
@@ -61,21 +65,27 @@ typedef enum Edu_Bool{
 	Edu_True,
 }Edu_Bool;
 
-typedef unsigned char 			Edu_u8;
-typedef unsigned short int 		Edu_u16;
-typedef unsigned long int 		Edu_u32;
-typedef unsigned long long int 	Edu_u64;
+/*Fixed width types, So sizes are the same on 32-bit targets and 64-bit hosts.*/
+typedef uint8_t 				Edu_u8;
+typedef uint16_t 				Edu_u16;
+typedef uint32_t 				Edu_u32;
+typedef uint64_t 				Edu_u64;
 
 
-typedef signed char 			Edu_s8;
-typedef signed short int 		Edu_s16;
-typedef signed long int 		Edu_s32;
-typedef signed long long int 	Edu_s64;
+typedef int8_t 					Edu_s8;
+typedef int16_t 				Edu_s16;
+typedef int32_t 				Edu_s32;
+typedef int64_t 				Edu_s64;
+
+/*Unsigned integer that can hold address (32-bit on Cortex-M, 64-bit on 64-bit hosts).*/
+typedef uintptr_t				Edu_uptr;
 
 typedef double					Edu_f32;
 typedef double					Edu_f64;
 
 #define EduRTOS_INFINITE		(Edu_u32)0xFFFFFFFF
+/*Id returned by EduRTOS_CreateTask when there is no free TCB or stack memory.*/
+#define EduRTOS_INVALID_TASK	(Edu_u32)0xFFFFFFFF
 
 extern Edu_u32  volatile const * EduRTOS_Shared_CurrentTickNumber ;
 extern Edu_u32  volatile const * EduRTOS_Shared_CurrentRunningTask ;
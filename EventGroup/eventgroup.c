@@ -0,0 +1,69 @@
+/*
+ * File Name --> eventgroup.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Event group implementation.
+ * */
+
+#include "eventgroup.h"
+#include "Task/task.h"
+#include "Port/port.h"
+
+EduRTOS_StdType_Status EventGroupInit(EventGroup * const Arg_EventGroup){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	Arg_EventGroup->Events = 0;
+	/*No tasks wait events*/
+	EduRTOS_ListInit(&Arg_EventGroup->WaitingTasksList);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+
+Edu_u32 EventGroupSet(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		return 0;
+	}
+	/*Wait list is checked once, and all tasks that their condition is met are woken up.*/
+	return EduRTOS_TaskSet_EventGroup(Arg_EventGroup, Arg_Events);
+}
+
+
+Edu_u32 EventGroupSetFromISR(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events, Edu_Bool * const HigherPriorityTaskWoken){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		return 0;
+	}
+	return EduRTOS_TaskSet_EventGroupFromISR(Arg_EventGroup, Arg_Events, HigherPriorityTaskWoken);
+}
+
+
+Edu_u32 EventGroupClear(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		return 0;
+	}
+	/*Clearing events never wakes up tasks.*/
+	EduRTOS_EnterCritical();
+	const Edu_u32 Events = Arg_EventGroup->Events;
+	Arg_EventGroup->Events &= ~Arg_Events;
+	EduRTOS_ExitCritical();
+	return Events;
+}
+
+
+Edu_u32 EventGroupGet(EventGroup * const Arg_EventGroup){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		return 0;
+	}
+	return Arg_EventGroup->Events;
+}
+
+
+EduRTOS_StdType_Status EventGroupWait(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events, const Edu_Bool Arg_WaitAll,
+		const Edu_Bool Arg_ClearOnExit, Edu_u32 * const Arg_ReceivedEvents, const Edu_u32 Arg_TicksToWait){
+	/*Condition of no events is never met.*/
+	if ((EduRTOS_NULL == Arg_EventGroup) || (0 == Arg_Events)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	return EduRTOS_TaskWait_EventGroup(Arg_EventGroup, Arg_Events, Arg_WaitAll, Arg_ClearOnExit, Arg_ReceivedEvents, Arg_TicksToWait);
+}
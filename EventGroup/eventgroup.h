@@ -0,0 +1,100 @@
+/*
+ * File Name --> eventgroup.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides API for Event group.
+ * */
+
+#ifndef EVENTGROUP_H_
+#define EVENTGROUP_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+#include "List/list.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Event group defines
+==================================================
+ */
+typedef struct{
+	/*Each bit is one event (condition), It's set till it's cleared by task or by waiter that clears it on exit.*/
+	Edu_u32 Events;
+	/*Tasks blocked on this event group sorted by priority, Each one waits its own events.*/
+	EduRTOS_List WaitingTasksList;
+}EventGroup;
+/*
+==================================================
+  End Section --> Event group defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  					--> Initialize Event group, All events are cleared.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @retval --> Status if it's initialized successfully or not.
+ * */
+EduRTOS_StdType_Status EventGroupInit(EventGroup * const Arg_EventGroup);
+
+/* @brief  					--> Set events, All tasks whose wait condition is met are woken up.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Arg_Events 		--> Bits of events that are set.
+ * @retval --> Events after setting them (and after clearing events of woken tasks that clear them on exit), or 0 if event group is NULL.
+ * */
+Edu_u32 EventGroupSet(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events);
+
+/* @brief  							--> Set events from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_EventGroup 			--> Pointer of event group.
+ * @param  Arg_Events 				--> Bits of events that are set.
+ * @param  HigherPriorityTaskWoken 	--> Set to Edu_True if higher priority task is woken up, Pass it to EduRTOS_YieldFromISR at end of handler.
+ * @retval --> Events after setting them, or 0 if event group is NULL.
+ * */
+Edu_u32 EventGroupSetFromISR(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events, Edu_Bool * const HigherPriorityTaskWoken);
+
+/* @brief  					--> Clear events.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Arg_Events 		--> Bits of events that are cleared.
+ * @retval --> Events before clearing them, or 0 if event group is NULL.
+ * */
+Edu_u32 EventGroupClear(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events);
+
+/* @brief  					--> Get current events.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @retval --> Events, or 0 if event group is NULL.
+ * */
+Edu_u32 EventGroupGet(EventGroup * const Arg_EventGroup);
+
+/* @brief  					--> Wait any or all of events, If condition isn't met task is blocked till it's met or timeout.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Arg_Events 		--> Bits of waited events, It must not be 0.
+ * @param  Arg_WaitAll 		--> Edu_True to wait all events, Edu_False to wait any of them.
+ * @param  Arg_ClearOnExit 	--> Edu_True to clear waited events once condition is met.
+ * @param  Arg_ReceivedEvents --> Events when condition is met (or at timeout) before they are cleared, It may be NULL.
+ * @param  Arg_TicksToWait 	--> Timeout value (0 to return immediately, EduRTOS_INFINITE to wait forever).
+ * @retval --> EduRTOS_StdType_Status_Succeed if condition is met, EduRTOS_StdType_Status_Timeout if timeout is passed,
+ * EduRTOS_StdType_Status_Fail if event group is NULL or events are 0.
+ * */
+EduRTOS_StdType_Status EventGroupWait(EventGroup * const Arg_EventGroup, const Edu_u32 Arg_Events, const Edu_Bool Arg_WaitAll,
+		const Edu_Bool Arg_ClearOnExit, Edu_u32 * const Arg_ReceivedEvents, const Edu_u32 Arg_TicksToWait);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+#endif /* EVENTGROUP_H_ */
@@ -0,0 +1,322 @@
+/*
+ * File Name --> heap.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> TLSF (Two-Level Segregated Fit) heap implementation.
+ * Note		 --> Free blocks are kept in lists of size classes, First level is power of two of size and second level divides it
+ * 				 into EduRTOS_HEAP_SL_COUNT equal ranges. Bitmaps of non-empty lists are searched by count-leading-zeros,
+ * 				 So allocation and free don't depend on number of blocks.
+ * */
+
+#include "heap.h"
+#include "Port/port.h"
+
+#if EduRTOS_Config_USE_HEAP
+
+#if EduRTOS_Config_HEAP_SIZE >= (1UL << 24)
+#error "EduRTOS_Config_HEAP_SIZE must be less than 16Mb"
+#endif
+
+/*
+==================================================
+  Start Section --> Heap defines
+==================================================
+ */
+
+/*Number of second level lists of each first level is 2^EduRTOS_HEAP_SL_LOG2.*/
+#define 	EduRTOS_HEAP_SL_LOG2				3
+#define 	EduRTOS_HEAP_SL_COUNT				(1UL << EduRTOS_HEAP_SL_LOG2)
+#define 	EduRTOS_HEAP_ALIGNMENT_LOG2			((8 == sizeof(void *)) ? 4 : 3)
+/*Blocks smaller than EduRTOS_HEAP_SMALL_BLOCK are in first level 0, and its second level lists are EduRTOS_HEAP_ALIGNMENT apart.*/
+#define 	EduRTOS_HEAP_FL_SHIFT				(EduRTOS_HEAP_SL_LOG2 + EduRTOS_HEAP_ALIGNMENT_LOG2)
+#define 	EduRTOS_HEAP_SMALL_BLOCK			(1UL << EduRTOS_HEAP_FL_SHIFT)
+/*Blocks are less than 2^EduRTOS_HEAP_FL_INDEX_MAX bytes.*/
+#define 	EduRTOS_HEAP_FL_INDEX_MAX			24
+#define 	EduRTOS_HEAP_FL_COUNT				(EduRTOS_HEAP_FL_INDEX_MAX - EduRTOS_HEAP_FL_SHIFT + 1)
+/*Requests are less than 2^(EduRTOS_HEAP_FL_INDEX_MAX - 1) bytes, So they stay below the highest first level after rounding up.*/
+#define 	EduRTOS_HEAP_MAX_ALLOCATION			((1UL << (EduRTOS_HEAP_FL_INDEX_MAX - 1)) - EduRTOS_HEAP_ALIGNMENT)
+
+/*Bit 0 of size of block is set while block is free, As sizes are multiple of alignment.*/
+#define 	EduRTOS_HEAP_BLOCK_FREE				1UL
+
+typedef struct EduRTOS_HeapBlock{
+	/*Block before this one in memory, It's NULL for first block.*/
+	struct EduRTOS_HeapBlock *PreviousPhysical;
+	/*Size of payload of block in bytes, and free flag.*/
+	Edu_uptr Size;
+	/*Links of free list, They are stored in payload so they exist only while block is free.*/
+	struct EduRTOS_HeapBlock *NextFree;
+	struct EduRTOS_HeapBlock *PreviousFree;
+}EduRTOS_HeapBlock;
+
+/*Payload of block starts after PreviousPhysical & Size, Its size is EduRTOS_HEAP_ALIGNMENT so payload stays aligned.*/
+#define 	EduRTOS_HEAP_HEADER_SIZE			EduRTOS_HEAP_ALIGNMENT
+/*Payload must hold links of free list.*/
+#define 	EduRTOS_HEAP_MIN_BLOCK				EduRTOS_HEAP_ALIGNMENT
+
+#define 	EduRTOS_HeapBlockSize(Block)		((Block)->Size & ~EduRTOS_HEAP_BLOCK_FREE)
+#define 	EduRTOS_HeapBlockIsFree(Block)		(0 != ((Block)->Size & EduRTOS_HEAP_BLOCK_FREE))
+#define 	EduRTOS_HeapPayload(Block)			((void *)((Edu_u8 *)(Block) + EduRTOS_HEAP_HEADER_SIZE))
+#define 	EduRTOS_HeapNextPhysical(Block)		((EduRTOS_HeapBlock *)((Edu_u8 *)EduRTOS_HeapPayload(Block) + EduRTOS_HeapBlockSize(Block)))
+/*
+==================================================
+  End Section --> Heap defines
+==================================================
+ */
+
+/*Bit (fl) is set when any list of first level (fl) isn't empty, and bit (sl) of EduRTOS_HeapSLBitmap[fl] when list (fl, sl) isn't empty.*/
+static Edu_u32 EduRTOS_HeapFLBitmap = 0;
+static Edu_u32 EduRTOS_HeapSLBitmap[EduRTOS_HEAP_FL_COUNT];
+static EduRTOS_HeapBlock *EduRTOS_HeapFreeLists[EduRTOS_HEAP_FL_COUNT][EduRTOS_HEAP_SL_COUNT];
+
+/*First block and last block (zero size used block, So merging stops at it).*/
+static EduRTOS_HeapBlock *EduRTOS_HeapFirstBlock = EduRTOS_NULL;
+static EduRTOS_HeapBlock *EduRTOS_HeapLastBlock = EduRTOS_NULL;
+
+static EduRTOS_HeapStats EduRTOS_HeapStatistics;
+
+/*Index of the most significant set bit (Value isn't zero).*/
+#define 	EduRTOS_HeapFls(Value)				(31 - EduRTOS_Port_CountLeadingZeros((Edu_u32)(Value)))
+/*Index of the least significant set bit (Value isn't zero).*/
+#define 	EduRTOS_HeapFfs(Value)				EduRTOS_HeapFls((Value) & (~(Value) + 1))
+
+/* @brief  	  --> Find list of free blocks whose sizes are in the same range of size.
+ * @param  Size --> Size of block.
+ * @param  FL 	--> First level index.
+ * @param  SL 	--> Second level index.
+ * */
+static void EduRTOS_HeapMapping(const Edu_uptr Size, Edu_u32 * const FL, Edu_u32 * const SL){
+	if (Size < EduRTOS_HEAP_SMALL_BLOCK){
+		*FL = 0;
+		*SL = (Edu_u32)(Size / (EduRTOS_HEAP_SMALL_BLOCK / EduRTOS_HEAP_SL_COUNT));
+	}
+	else{
+		const Edu_u32 Fls = EduRTOS_HeapFls(Size);
+		*SL = (Edu_u32)((Size >> (Fls - EduRTOS_HEAP_SL_LOG2)) ^ EduRTOS_HEAP_SL_COUNT);
+		*FL = Fls - (EduRTOS_HEAP_FL_SHIFT - 1);
+	}
+}
+
+static void EduRTOS_HeapInsertFree(EduRTOS_HeapBlock * const Block){
+	Edu_u32 FL, SL;
+	EduRTOS_HeapMapping(EduRTOS_HeapBlockSize(Block), &FL, &SL);
+
+	Block->Size |= EduRTOS_HEAP_BLOCK_FREE;
+	Block->PreviousFree = EduRTOS_NULL;
+	Block->NextFree = EduRTOS_HeapFreeLists[FL][SL];
+	if (EduRTOS_NULL != Block->NextFree){
+		Block->NextFree->PreviousFree = Block;
+	}
+	EduRTOS_HeapFreeLists[FL][SL] = Block;
+	EduRTOS_HeapFLBitmap |= (1UL << FL);
+	EduRTOS_HeapSLBitmap[FL] |= (1UL << SL);
+
+	EduRTOS_HeapStatistics.NumberOfFreeBlocks++;
+	EduRTOS_HeapStatistics.FreeSize += (Edu_u32)EduRTOS_HeapBlockSize(Block);
+}
+
+static void EduRTOS_HeapRemoveFree(EduRTOS_HeapBlock * const Block){
+	Edu_u32 FL, SL;
+	EduRTOS_HeapMapping(EduRTOS_HeapBlockSize(Block), &FL, &SL);
+
+	if (EduRTOS_NULL != Block->NextFree){
+		Block->NextFree->PreviousFree = Block->PreviousFree;
+	}
+	if (EduRTOS_NULL != Block->PreviousFree){
+		Block->PreviousFree->NextFree = Block->NextFree;
+	}
+	else{
+		EduRTOS_HeapFreeLists[FL][SL] = Block->NextFree;
+		/*List becomes empty.*/
+		if (EduRTOS_NULL == Block->NextFree){
+			EduRTOS_HeapSLBitmap[FL] &= ~(1UL << SL);
+			if (0 == EduRTOS_HeapSLBitmap[FL]){
+				EduRTOS_HeapFLBitmap &= ~(1UL << FL);
+			}
+		}
+	}
+	Block->Size &= ~EduRTOS_HEAP_BLOCK_FREE;
+
+	EduRTOS_HeapStatistics.NumberOfFreeBlocks--;
+	EduRTOS_HeapStatistics.FreeSize -= (Edu_u32)EduRTOS_HeapBlockSize(Block);
+}
+
+/* @brief  	  --> Round size of free block down to start of its range, Requests are rounded up to start of next range
+ * before search, So start of range is the largest request that is satisfied by block.
+ * @param  Size --> Size of block.
+ * @retval --> The largest size that can be allocated from block.
+ * */
+static Edu_uptr EduRTOS_HeapRoundDown(const Edu_uptr Size){
+	if (Size < EduRTOS_HEAP_SMALL_BLOCK){
+		return Size;
+	}
+	const Edu_uptr RoundedSize = Size & ~(Edu_uptr)((1UL << (EduRTOS_HeapFls(Size) - EduRTOS_HEAP_SL_LOG2)) - 1);
+	return (RoundedSize > EduRTOS_HEAP_MAX_ALLOCATION) ? EduRTOS_HEAP_MAX_ALLOCATION : RoundedSize;
+}
+
+/* @brief  	   --> Check that header is header of used block, Blocks are linked in memory order, So header that is read
+ * from address inside block or from block that is already merged into free block doesn't match its neighbours.
+ * Header is in heap, and neighbours are checked to be in heap before they are read.
+ * @param  Block --> Header before address that is freed.
+ * @retval --> Edu_True if it's used block.
+ * */
+static Edu_Bool EduRTOS_HeapIsUsedBlock(const EduRTOS_HeapBlock * const Block){
+	const Edu_uptr Size = EduRTOS_HeapBlockSize(Block);
+
+	if (EduRTOS_HeapBlockIsFree(Block) || (0 != (Size % EduRTOS_HEAP_ALIGNMENT)) ||
+			(Size > (Edu_uptr)((Edu_u8 *)EduRTOS_HeapLastBlock - (Edu_u8 *)EduRTOS_HeapPayload(Block)))){
+		return Edu_False;
+	}
+	if (EduRTOS_HeapNextPhysical(Block)->PreviousPhysical != Block){
+		return Edu_False;
+	}
+	const EduRTOS_HeapBlock * const Previous = Block->PreviousPhysical;
+	if (EduRTOS_NULL == Previous){
+		return (EduRTOS_HeapFirstBlock == Block) ? Edu_True : Edu_False;
+	}
+	if ((Previous < EduRTOS_HeapFirstBlock) || (Previous >= Block) || (0 != ((Edu_uptr)Previous % EduRTOS_HEAP_ALIGNMENT))){
+		return Edu_False;
+	}
+	return (EduRTOS_HeapNextPhysical(Previous) == Block) ? Edu_True : Edu_False;
+}
+
+/* @brief  --> Make whole region one free block, It's called at first allocation.
+ * */
+static void EduRTOS_HeapInit(void){
+	const Edu_uptr Start = ((Edu_uptr)EduRTOS_HEAP_START + EduRTOS_HEAP_ALIGNMENT - 1) & ~(Edu_uptr)(EduRTOS_HEAP_ALIGNMENT - 1);
+	const Edu_uptr End = ((Edu_uptr)EduRTOS_HEAP_START + EduRTOS_HEAP_SIZE) & ~(Edu_uptr)(EduRTOS_HEAP_ALIGNMENT - 1);
+
+	EduRTOS_HeapFirstBlock = (EduRTOS_HeapBlock *)Start;
+	EduRTOS_HeapFirstBlock->PreviousPhysical = EduRTOS_NULL;
+	/*Region holds header of first block, its payload and header of last block.*/
+	EduRTOS_HeapFirstBlock->Size = End - Start - (2 * EduRTOS_HEAP_HEADER_SIZE);
+
+	EduRTOS_HeapLastBlock = EduRTOS_HeapNextPhysical(EduRTOS_HeapFirstBlock);
+	EduRTOS_HeapLastBlock->PreviousPhysical = EduRTOS_HeapFirstBlock;
+	EduRTOS_HeapLastBlock->Size = 0;
+
+	EduRTOS_HeapStatistics.TotalSize = (Edu_u32)EduRTOS_HeapFirstBlock->Size;
+	EduRTOS_HeapInsertFree(EduRTOS_HeapFirstBlock);
+}
+
+void *EduRTOS_HeapAllocate(const Edu_u32 Size){
+	if ((0 == Size) || (Size > EduRTOS_HEAP_MAX_ALLOCATION)){
+		return EduRTOS_NULL;
+	}
+	const Edu_uptr AlignedSize = ((Edu_uptr)Size + EduRTOS_HEAP_ALIGNMENT - 1) & ~(Edu_uptr)(EduRTOS_HEAP_ALIGNMENT - 1);
+	/*Size is rounded up to start of next range, So any block of found list fits it without searching list.*/
+	Edu_uptr SearchSize = AlignedSize;
+	if (SearchSize >= EduRTOS_HEAP_SMALL_BLOCK){
+		SearchSize += (1UL << (EduRTOS_HeapFls(SearchSize) - EduRTOS_HEAP_SL_LOG2)) - 1;
+	}
+	Edu_u32 FL, SL;
+	EduRTOS_HeapMapping(SearchSize, &FL, &SL);
+
+	EduRTOS_EnterCritical();
+	if (EduRTOS_NULL == EduRTOS_HeapFirstBlock){
+		EduRTOS_HeapInit();
+	}
+	/*Search non-empty list of the same first level, then the smallest non-empty first level above it.*/
+	Edu_u32 SLMap = EduRTOS_HeapSLBitmap[FL] & ((Edu_u32)0xFFFFFFFFUL << SL);
+	if (0 == SLMap){
+		const Edu_u32 FLMap = EduRTOS_HeapFLBitmap & ((Edu_u32)0xFFFFFFFFUL << (FL + 1));
+		if (0 == FLMap){
+			EduRTOS_HeapStatistics.FailedAllocations++;
+			EduRTOS_ExitCritical();
+			return EduRTOS_NULL;
+		}
+		FL = EduRTOS_HeapFfs(FLMap);
+		SLMap = EduRTOS_HeapSLBitmap[FL];
+	}
+	SL = EduRTOS_HeapFfs(SLMap);
+	EduRTOS_HeapBlock * const Block = EduRTOS_HeapFreeLists[FL][SL];
+	EduRTOS_HeapRemoveFree(Block);
+
+	/*Rest of block is split as free block if it can hold header and links of free list.*/
+	if (EduRTOS_HeapBlockSize(Block) >= (AlignedSize + EduRTOS_HEAP_HEADER_SIZE + EduRTOS_HEAP_MIN_BLOCK)){
+		EduRTOS_HeapBlock * const Next = EduRTOS_HeapNextPhysical(Block);
+		EduRTOS_HeapBlock * const Remainder = (EduRTOS_HeapBlock *)((Edu_u8 *)EduRTOS_HeapPayload(Block) + AlignedSize);
+
+		Remainder->PreviousPhysical = Block;
+		Remainder->Size = EduRTOS_HeapBlockSize(Block) - AlignedSize - EduRTOS_HEAP_HEADER_SIZE;
+		Next->PreviousPhysical = Remainder;
+		Block->Size = AlignedSize;
+		EduRTOS_HeapInsertFree(Remainder);
+	}
+
+	EduRTOS_HeapStatistics.UsedSize += (Edu_u32)EduRTOS_HeapBlockSize(Block);
+	if (EduRTOS_HeapStatistics.UsedSize > EduRTOS_HeapStatistics.PeakUsedSize){
+		EduRTOS_HeapStatistics.PeakUsedSize = EduRTOS_HeapStatistics.UsedSize;
+	}
+	EduRTOS_ExitCritical();
+	return EduRTOS_HeapPayload(Block);
+}
+
+EduRTOS_StdType_Status EduRTOS_HeapFree(void * const Block){
+	EduRTOS_EnterCritical();
+	/*Address must be payload of used block inside heap.*/
+	if ((EduRTOS_NULL == EduRTOS_HeapFirstBlock) ||
+			((Edu_u8 *)Block < (Edu_u8 *)EduRTOS_HeapPayload(EduRTOS_HeapFirstBlock)) ||
+			((Edu_u8 *)Block >= (Edu_u8 *)EduRTOS_HeapLastBlock) ||
+			(0 != ((Edu_uptr)Block % EduRTOS_HEAP_ALIGNMENT))){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Fail;
+	}
+	EduRTOS_HeapBlock *FreedBlock = (EduRTOS_HeapBlock *)((Edu_u8 *)Block - EduRTOS_HEAP_HEADER_SIZE);
+	/*Block that is freed twice (even after it's merged) or address inside block.*/
+	if (Edu_True != EduRTOS_HeapIsUsedBlock(FreedBlock)){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Fail;
+	}
+	EduRTOS_HeapStatistics.UsedSize -= (Edu_u32)EduRTOS_HeapBlockSize(FreedBlock);
+
+	/*Merge with previous block if it's free.*/
+	EduRTOS_HeapBlock * const Previous = FreedBlock->PreviousPhysical;
+	if ((EduRTOS_NULL != Previous) && EduRTOS_HeapBlockIsFree(Previous)){
+		EduRTOS_HeapRemoveFree(Previous);
+		Previous->Size += EduRTOS_HEAP_HEADER_SIZE + EduRTOS_HeapBlockSize(FreedBlock);
+		FreedBlock = Previous;
+		EduRTOS_HeapNextPhysical(FreedBlock)->PreviousPhysical = FreedBlock;
+	}
+	/*Merge with next block if it's free, Last block is never free.*/
+	EduRTOS_HeapBlock * const Next = EduRTOS_HeapNextPhysical(FreedBlock);
+	if (EduRTOS_HeapBlockIsFree(Next)){
+		EduRTOS_HeapRemoveFree(Next);
+		FreedBlock->Size += EduRTOS_HEAP_HEADER_SIZE + EduRTOS_HeapBlockSize(Next);
+		EduRTOS_HeapNextPhysical(FreedBlock)->PreviousPhysical = FreedBlock;
+	}
+	EduRTOS_HeapInsertFree(FreedBlock);
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+EduRTOS_StdType_Status EduRTOS_HeapGetStats(EduRTOS_HeapStats * const Stats){
+	if (EduRTOS_NULL == Stats){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	EduRTOS_EnterCritical();
+	if (EduRTOS_NULL == EduRTOS_HeapFirstBlock){
+		EduRTOS_HeapInit();
+	}
+	*Stats = EduRTOS_HeapStatistics;
+	/*The largest free block is in the highest non-empty list, which isn't sorted.*/
+	Stats->LargestFreeBlock = 0;
+	if (0 != EduRTOS_HeapFLBitmap){
+		const Edu_u32 FL = EduRTOS_HeapFls(EduRTOS_HeapFLBitmap);
+		const Edu_u32 SL = EduRTOS_HeapFls(EduRTOS_HeapSLBitmap[FL]);
+		for (EduRTOS_HeapBlock *Block = EduRTOS_HeapFreeLists[FL][SL]; EduRTOS_NULL != Block; Block = Block->NextFree){
+			if (EduRTOS_HeapBlockSize(Block) > Stats->LargestFreeBlock){
+				Stats->LargestFreeBlock = (Edu_u32)EduRTOS_HeapBlockSize(Block);
+			}
+		}
+	}
+	Stats->FragmentationPercent = (0 == Stats->FreeSize) ? 0 :
+			(100 - (Edu_u32)(((Edu_u64)Stats->LargestFreeBlock * 100) / Stats->FreeSize));
+	/*Request of size of the largest block is rounded up to next range, So it's reported as start of its range.*/
+	Stats->LargestFreeBlock = (Edu_u32)EduRTOS_HeapRoundDown(Stats->LargestFreeBlock);
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+#endif
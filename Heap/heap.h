@@ -0,0 +1,89 @@
+/*
+ * File Name --> heap.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides API for TLSF (Two-Level Segregated Fit) heap.
+ * */
+
+#ifndef HEAP_H_
+#define HEAP_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Heap defines
+==================================================
+ */
+
+/*Allocated blocks are aligned by this value, and their sizes are rounded up to multiple of it.*/
+#define 	EduRTOS_HEAP_ALIGNMENT				(2 * sizeof(void *))
+
+/*Snapshot of statistics of heap, It's filled by EduRTOS_HeapGetStats.*/
+typedef struct{
+	/*Bytes that can be allocated when heap is empty (region without headers of blocks).*/
+	Edu_u32 TotalSize;
+	Edu_u32 FreeSize;
+	/*Bytes of allocated blocks now (after rounding).*/
+	Edu_u32 UsedSize;
+	/*High water mark, Maximum UsedSize since start.*/
+	Edu_u32 PeakUsedSize;
+	/*The largest size that can be allocated now, It's size of the largest free block rounded down to start of its size range.*/
+	Edu_u32 LargestFreeBlock;
+	Edu_u32 NumberOfFreeBlocks;
+	/*Percent of free bytes that aren't in the largest free block (0 means all free bytes are one block), It's calculated from
+	 * size of block before rounding.*/
+	Edu_u32 FragmentationPercent;
+	/*Number of allocations that returned NULL.*/
+	Edu_u32 FailedAllocations;
+}EduRTOS_HeapStats;
+/*
+==================================================
+  End Section --> Heap defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  			--> Allocate block from heap, It's done in bounded time whatever number of blocks is.
+ * It's called by tasks only (It uses kernel critical section).
+ * @param  Size 	--> Size of block in bytes.
+ * @retval --> Address of block (aligned by EduRTOS_HEAP_ALIGNMENT), or NULL if size is 0, it's larger than LargestFreeBlock of statistics
+ * or there is no free block that fits it.
+ * */
+void *EduRTOS_HeapAllocate(const Edu_u32 Size);
+
+/* @brief  			--> Free block, It's merged with adjacent free blocks in bounded time.
+ * @param  Block 	--> Address of block returned by EduRTOS_HeapAllocate.
+ * @retval --> EduRTOS_StdType_Status_Fail if address isn't start of allocated block of heap (address inside block or block that is
+ * already freed), Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+EduRTOS_StdType_Status EduRTOS_HeapFree(void * const Block);
+
+/* @brief  			--> Get snapshot of statistics of heap.
+ * @param  Stats 	--> Pointer of statistics that is filled.
+ * @retval --> Status if statistics are filled or not.
+ * */
+EduRTOS_StdType_Status EduRTOS_HeapGetStats(EduRTOS_HeapStats * const Stats);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+#endif /* HEAP_H_ */
@@ -0,0 +1,108 @@
+/*
+ * File Name --> list.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Intrusive doubly linked list implementation.
+ * Note		 --> Lists are shared with interrupts, so caller must protect them by critical section.
+ * */
+
+#include "list.h"
+
+void EduRTOS_ListInit(EduRTOS_List * const Arg_List){
+	Arg_List->Head = EduRTOS_NULL;
+	Arg_List->Tail = EduRTOS_NULL;
+	Arg_List->NumberOfItems = 0;
+}
+
+void EduRTOS_ListItemInit(EduRTOS_ListItem * const Arg_Item, void * const Arg_Owner){
+	Arg_Item->Next = EduRTOS_NULL;
+	Arg_Item->Previous = EduRTOS_NULL;
+	Arg_Item->ItemValue = 0;
+	Arg_Item->Owner = Arg_Owner;
+	Arg_Item->Container = EduRTOS_NULL;
+}
+
+void EduRTOS_ListInsertTail(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item){
+	Arg_Item->Next = EduRTOS_NULL;
+	Arg_Item->Previous = Arg_List->Tail;
+
+	if (EduRTOS_NULL == Arg_List->Tail){
+		Arg_List->Head = Arg_Item;
+	}
+	else{
+		Arg_List->Tail->Next = Arg_Item;
+	}
+	Arg_List->Tail = Arg_Item;
+	Arg_Item->Container = Arg_List;
+	Arg_List->NumberOfItems++;
+}
+
+void EduRTOS_ListInsertHead(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item){
+	Arg_Item->Previous = EduRTOS_NULL;
+	Arg_Item->Next = Arg_List->Head;
+
+	if (EduRTOS_NULL == Arg_List->Head){
+		Arg_List->Tail = Arg_Item;
+	}
+	else{
+		Arg_List->Head->Previous = Arg_Item;
+	}
+	Arg_List->Head = Arg_Item;
+	Arg_Item->Container = Arg_List;
+	Arg_List->NumberOfItems++;
+}
+
+void EduRTOS_ListInsertOrdered(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item){
+	EduRTOS_ListItem *Iterator = Arg_List->Head;
+
+	/*Find first item that has bigger value, Items with same value are skipped to keep FIFO order.*/
+	while ((EduRTOS_NULL != Iterator) && ((Edu_s32)(Arg_Item->ItemValue - Iterator->ItemValue) >= 0)){
+		Iterator = Iterator->Next;
+	}
+
+	if (EduRTOS_NULL == Iterator){
+		EduRTOS_ListInsertTail(Arg_List, Arg_Item);
+		return;
+	}
+
+	/*Insert before iterator*/
+	Arg_Item->Next = Iterator;
+	Arg_Item->Previous = Iterator->Previous;
+	if (EduRTOS_NULL == Iterator->Previous){
+		Arg_List->Head = Arg_Item;
+	}
+	else{
+		Iterator->Previous->Next = Arg_Item;
+	}
+	Iterator->Previous = Arg_Item;
+	Arg_Item->Container = Arg_List;
+	Arg_List->NumberOfItems++;
+}
+
+void EduRTOS_ListRemove(EduRTOS_ListItem * const Arg_Item){
+	EduRTOS_List * const Container = Arg_Item->Container;
+
+	if (EduRTOS_NULL == Container){
+		return;
+	}
+
+	if (EduRTOS_NULL == Arg_Item->Previous){
+		Container->Head = Arg_Item->Next;
+	}
+	else{
+		Arg_Item->Previous->Next = Arg_Item->Next;
+	}
+
+	if (EduRTOS_NULL == Arg_Item->Next){
+		Container->Tail = Arg_Item->Previous;
+	}
+	else{
+		Arg_Item->Next->Previous = Arg_Item->Previous;
+	}
+
+	Arg_Item->Next = EduRTOS_NULL;
+	Arg_Item->Previous = EduRTOS_NULL;
+	Arg_Item->Container = EduRTOS_NULL;
+	Container->NumberOfItems--;
+}
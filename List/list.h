@@ -0,0 +1,109 @@
+/*
+ * File Name --> list.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides intrusive doubly linked list used by kernel (Delayed tasks, waiting tasks ,... etc).
+ * */
+
+#ifndef LIST_H_
+#define LIST_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> List defines
+==================================================
+ */
+
+/*
+ * Item is embedded inside its owner (for example TCB), so no memory allocation is needed.
+ * */
+typedef struct EduRTOS_ListItem{
+	struct EduRTOS_ListItem *Next;
+	struct EduRTOS_ListItem *Previous;
+	/*Value used to sort list items (For example wakeup tick).*/
+	Edu_u32 ItemValue;
+	/*Object that contains this item.*/
+	void *Owner;
+	/*List that holds this item, It's NULL when item isn't inserted in any list.*/
+	struct EduRTOS_List *Container;
+}EduRTOS_ListItem;
+
+/*
+ * Zero initialized list is an empty list.
+ * */
+typedef struct EduRTOS_List{
+	EduRTOS_ListItem *Head;
+	EduRTOS_ListItem *Tail;
+	Edu_u32 NumberOfItems;
+}EduRTOS_List;
+
+#define		EduRTOS_ListIsEmpty(List)				(0 == (List)->NumberOfItems)
+#define		EduRTOS_ListGetHead(List)				((List)->Head)
+#define		EduRTOS_ListItemIsInserted(Item)		(EduRTOS_NULL != (Item)->Container)
+/*
+==================================================
+  End Section --> List defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  			--> Initialize list as empty list.
+ * @param  Arg_List --> Pointer of list.
+ * */
+void EduRTOS_ListInit(EduRTOS_List * const Arg_List);
+
+/* @brief  			 --> Initialize list item.
+ * @param  Arg_Item  --> Pointer of list item.
+ * @param  Arg_Owner --> Pointer of object that contains list item.
+ * */
+void EduRTOS_ListItemInit(EduRTOS_ListItem * const Arg_Item, void * const Arg_Owner);
+
+/* @brief  			--> Insert item at the end of list.
+ * @param  Arg_List --> Pointer of list.
+ * @param  Arg_Item --> Pointer of list item.
+ * */
+void EduRTOS_ListInsertTail(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item);
+
+/* @brief  			--> Insert item at the beginning of list.
+ * @param  Arg_List --> Pointer of list.
+ * @param  Arg_Item --> Pointer of list item.
+ * */
+void EduRTOS_ListInsertHead(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item);
+
+/* @brief  			--> Insert item in ascending order of ItemValue, Items that have same value are kept in FIFO order.
+ * Values are compared by their difference (as signed 32-bit) so tick numbers remain in order when tick counter overflows,
+ * Thus difference between any two values in list must be less than 0x80000000.
+ * @param  Arg_List --> Pointer of list.
+ * @param  Arg_Item --> Pointer of list item, ItemValue must be assigned before insertion.
+ * */
+void EduRTOS_ListInsertOrdered(EduRTOS_List * const Arg_List, EduRTOS_ListItem * const Arg_Item);
+
+/* @brief  			--> Remove item from the list that holds it.
+ * @param  Arg_Item --> Pointer of list item.
+ * */
+void EduRTOS_ListRemove(EduRTOS_ListItem * const Arg_Item);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+#endif /* LIST_H_ */
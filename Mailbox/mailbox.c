@@ -7,6 +7,60 @@
  * */
 
 #include "mailbox.h"
+#include "Port/port.h"
+
+/* @brief  				--> Store data at rear of mailbox buffer, It must be called inside critical section.
+ * @param  Arg_Mailbox 	--> Pointer of mailbox.
+ * @param  Arg_Data 	--> Data that is written.
+ * @retval --> EduRTOS_Mailbox_WriteSucceed, or EduRTOS_Mailbox_Full if there is no empty place.
+ * */
+static EduMailbox_State MailBoxEnqueue(MailBox * const Arg_Mailbox, const Edu_u32 Arg_Data){
+	/*Check if it's full.
+	 * If it's full, It can't write any more data.*/
+	if ((Arg_Mailbox->Rear+1)%Arg_Mailbox->BufferSize == Arg_Mailbox->Front){
+		return EduRTOS_Mailbox_Full;
+	}
+	/*Check if it's empty*/
+	else if (Arg_Mailbox->Front == -1){
+		Arg_Mailbox->Front = 0;
+		Arg_Mailbox->Rear = 0;
+	}
+	else{
+		Arg_Mailbox->Rear = (Arg_Mailbox->Rear + 1) %Arg_Mailbox->BufferSize;
+	}
+	Arg_Mailbox->MailboxLength++;
+	Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Rear] = Arg_Data;
+
+	return EduRTOS_Mailbox_WriteSucceed;
+}
+
+/* @brief  				--> Remove data from front of mailbox buffer, It must be called inside critical section.
+ * @param  Arg_Mailbox 	--> Pointer of mailbox.
+ * @param  Arg_Data 	--> Read data is stored in it.
+ * @retval --> EduRTOS_Mailbox_ReadSucceed, or EduRTOS_Mailbox_Empty if there is no data.
+ * */
+static EduMailbox_State MailBoxDequeue(MailBox * const Arg_Mailbox, Edu_u32 * const Arg_Data){
+	/*Check if it's empty.
+	 * If it's empty, you can't read data.*/
+	if (Arg_Mailbox->Front == -1){
+		return EduRTOS_Mailbox_Empty;
+	}
+	else if (Arg_Mailbox->Front == Arg_Mailbox->Rear){
+
+		*Arg_Data = Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Front];
+		Arg_Mailbox->Front = -1;
+		Arg_Mailbox->Rear  = -1;
+
+	}
+	else{
+		*Arg_Data = Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Front];
+		Arg_Mailbox->Front = (Arg_Mailbox->Front + 1) % Arg_Mailbox->BufferSize;
+	}
+	Arg_Mailbox->MailboxLength--;
+
+	return EduRTOS_Mailbox_ReadSucceed;
+}
+
 EduRTOS_StdType_Status MailBoxInit(MailBox *Arg_Mailbox, Edu_u32 *Arg_Array , Edu_u32 BufferSize){
 	if (EduRTOS_NULL == Arg_Array){
 		return EduRTOS_StdType_Status_Fail;
@@ -33,25 +87,23 @@ EduMailbox_State MailBoxWrite(MailBox *Arg_Mailbox, Edu_u32 Arg_Data, const Edu_
 		return EduRTOS_Mailbox_Error;
 	}
 
-	if (EduRTOS_StdType_Status_Succeed != SemaphoreTake(&Arg_Mailbox->WritingSemaphore, Arg_TicksToWait)){
+	/*Wait till there is empty place in mailbox.*/
+	switch (SemaphoreTake(&Arg_Mailbox->WritingSemaphore, Arg_TicksToWait)){
+	case EduRTOS_StdType_Status_Succeed:
+		break;
+	case EduRTOS_StdType_Status_Timeout:
+		return EduRTOS_Mailbox_Full;
+	default:
 		return EduRTOS_Mailbox_Error;
 	}
 
-	/*Check if it's full.
-	 * If it's full, It can't write any more data.*/
-	if ((Arg_Mailbox->Rear+1)%Arg_Mailbox->BufferSize == Arg_Mailbox->Front){
-		return EduRTOS_Mailbox_Full;
+	/*Buffer is shared with other tasks and interrupts (MailBoxWriteFromISR).*/
+	EduRTOS_EnterCritical();
+	const EduMailbox_State State = MailBoxEnqueue(Arg_Mailbox, Arg_Data);
+	EduRTOS_ExitCritical();
+	if (EduRTOS_Mailbox_WriteSucceed != State){
+		return State;
 	}
-	/*Check if it's empty*/
-	else if (Arg_Mailbox->Front == -1){
-		Arg_Mailbox->Front = 0;
-		Arg_Mailbox->Rear = 0;
-	}
-	else{
-		Arg_Mailbox->Rear = (Arg_Mailbox->Rear + 1) %Arg_Mailbox->BufferSize;
-	}
-	Arg_Mailbox->MailboxLength++;
-	Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Rear] = Arg_Data;
 
 	if (EduRTOS_StdType_Status_Succeed != SemaphoreGive(&Arg_Mailbox->ReadingSemaphore, Arg_TicksToWait)){
 		return EduRTOS_Mailbox_Error;
@@ -68,29 +120,48 @@ EduMailbox_State MailBoxRead(MailBox *Arg_Mailbox, Edu_u32 *Arg_Data, const Edu_
 		return EduRTOS_Mailbox_Error;
 	}
 
-	if (EduRTOS_StdType_Status_Succeed != SemaphoreTake(&Arg_Mailbox->ReadingSemaphore, Arg_TicksToWait)){
+	/*Wait till there is data in mailbox.*/
+	switch (SemaphoreTake(&Arg_Mailbox->ReadingSemaphore, Arg_TicksToWait)){
+	case EduRTOS_StdType_Status_Succeed:
+		break;
+	case EduRTOS_StdType_Status_Timeout:
+		return EduRTOS_Mailbox_Empty;
+	default:
 		return EduRTOS_Mailbox_Error;
 	}
-	/*Check if it's empty.
-	 * If it's empty, you can't read data.*/
-	if (Arg_Mailbox->Front == -1){
-		return EduRTOS_Mailbox_Empty;
+	EduRTOS_EnterCritical();
+	const EduMailbox_State State = MailBoxDequeue(Arg_Mailbox, Arg_Data);
+	EduRTOS_ExitCritical();
+	if (EduRTOS_Mailbox_ReadSucceed != State){
+		return State;
 	}
-	else if (Arg_Mailbox->Front == Arg_Mailbox->Rear){
 
-		*Arg_Data = Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Front];
-		Arg_Mailbox->Front = -1;
-		Arg_Mailbox->Rear  = -1;
+	if (EduRTOS_StdType_Status_Succeed != SemaphoreGive(&Arg_Mailbox->WritingSemaphore, Arg_TicksToWait)){
+		return EduRTOS_Mailbox_Error;
+	}
+	return EduRTOS_Mailbox_ReadSucceed;
+}
 
+EduMailbox_State MailBoxWriteFromISR(MailBox * const Arg_Mailbox, const Edu_u32 Arg_Data, Edu_Bool * const HigherPriorityTaskWoken){
+	if (EduRTOS_NULL == Arg_Mailbox){
+		return EduRTOS_Mailbox_Error;
 	}
-	else{
-		*Arg_Data = Arg_Mailbox->MailboxBuffer[Arg_Mailbox->Front];
-		Arg_Mailbox->Front = (Arg_Mailbox->Front + 1) % Arg_Mailbox->BufferSize;
+
+	/*Interrupt can't wait for empty place.*/
+	if (EduRTOS_StdType_Status_Succeed != SemaphoreTakeFromISR(&Arg_Mailbox->WritingSemaphore)){
+		return EduRTOS_Mailbox_Full;
 	}
-	Arg_Mailbox->MailboxLength--;
 
-	if (EduRTOS_StdType_Status_Succeed != SemaphoreGive(&Arg_Mailbox->WritingSemaphore, Arg_TicksToWait)){
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	const EduMailbox_State State = MailBoxEnqueue(Arg_Mailbox, Arg_Data);
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	if (EduRTOS_Mailbox_WriteSucceed != State){
+		return State;
+	}
+
+	/*Reader that waits data is woken up, and context switching is deferred to EduRTOS_YieldFromISR.*/
+	if (EduRTOS_StdType_Status_Succeed != SemaphoreGiveFromISR(&Arg_Mailbox->ReadingSemaphore, HigherPriorityTaskWoken)){
 		return EduRTOS_Mailbox_Error;
 	}
-	return EduRTOS_Mailbox_ReadSucceed;
+	return EduRTOS_Mailbox_WriteSucceed;
 }
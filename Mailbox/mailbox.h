@@ -83,6 +83,14 @@ EduMailbox_State MailBoxWrite(MailBox *Arg_Mailbox, Edu_u32 Arg_Data, const Edu_
  * @retval --> Status if data reading is successfully ,or failed due to specific reason like mailbox is empty.
  * */
 EduMailbox_State MailBoxRead(MailBox *Arg_Mailbox, Edu_u32 *Arg_Data, const Edu_u32 Arg_TicksToWait);
+
+/* @brief  						--> Write data to Mailbox from interrupt handler, It never blocks and never switches context.
+ * @param  MailBox 				--> Pointer of mailbox.
+ * @param  Arg_Data 			--> Data that you need to write in Mailbox.
+ * @param  HigherPriorityTaskWoken --> Set to Edu_True if higher priority reader is woken up, Pass it to EduRTOS_YieldFromISR at end of handler.
+ * @retval --> EduRTOS_Mailbox_WriteSucceed, or EduRTOS_Mailbox_Full if there is no empty place.
+ * */
+EduMailbox_State MailBoxWriteFromISR(MailBox * const Arg_Mailbox, const Edu_u32 Arg_Data, Edu_Bool * const HigherPriorityTaskWoken);
 /*
 ==================================================
   End Section --> APIs
@@ -0,0 +1,115 @@
+/*
+ * File Name --> memorypool.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Memory pool implementation.
+ * */
+
+#include "memorypool.h"
+#include "Task/task.h"
+#include "Port/port.h"
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+
+/* @brief  					--> Check that address is start of a block of pool.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Arg_Block 		--> Address of block.
+ * @retval --> Edu_True if it's a block of pool.
+ * */
+static Edu_Bool MemoryPoolIsBlock(const MemoryPool * const Arg_MemoryPool, const void * const Arg_Block){
+	const Edu_u8 * const Block = (const Edu_u8 *)Arg_Block;
+
+	if ((Block < Arg_MemoryPool->Buffer) ||
+			(Block >= (Arg_MemoryPool->Buffer + (Arg_MemoryPool->NumberOfBlocks * Arg_MemoryPool->BlockSize)))){
+		return Edu_False;
+	}
+	return (0 == ((Edu_uptr)(Block - Arg_MemoryPool->Buffer) % Arg_MemoryPool->BlockSize)) ? Edu_True : Edu_False;
+}
+
+
+EduRTOS_StdType_Status MemoryPoolInit(MemoryPool * const Arg_MemoryPool, void * const Arg_Buffer,
+		const Edu_u32 Arg_BufferSize, const Edu_u32 Arg_BlockSize){
+	if ((EduRTOS_NULL == Arg_MemoryPool) || (EduRTOS_NULL == Arg_Buffer) || (0 == Arg_BlockSize) ||
+			(0 != ((Edu_uptr)Arg_Buffer % EduRTOS_MEMORY_POOL_ALIGNMENT))){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	/*Each free block holds address of next free block.*/
+	const Edu_u32 BlockSize = (Arg_BlockSize + EduRTOS_MEMORY_POOL_ALIGNMENT - 1) & ~(Edu_u32)(EduRTOS_MEMORY_POOL_ALIGNMENT - 1);
+	const Edu_u32 NumberOfBlocks = Arg_BufferSize / BlockSize;
+	if ((0 == NumberOfBlocks) || (NumberOfBlocks > EduRTOS_Config_MEMORY_POOL_MAX_BLOCKS)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+
+	Arg_MemoryPool->Buffer = (Edu_u8 *)Arg_Buffer;
+	Arg_MemoryPool->BlockSize = BlockSize;
+	Arg_MemoryPool->NumberOfBlocks = NumberOfBlocks;
+	/*Blocks are linked in address order, So the first block is allocated first.*/
+	for (Edu_u32 i = 0; i < (NumberOfBlocks - 1); i++){
+		*(void **)(Arg_MemoryPool->Buffer + (i * BlockSize)) = Arg_MemoryPool->Buffer + ((i + 1) * BlockSize);
+	}
+	*(void **)(Arg_MemoryPool->Buffer + ((NumberOfBlocks - 1) * BlockSize)) = EduRTOS_NULL;
+	Arg_MemoryPool->FreeList = Arg_MemoryPool->Buffer;
+	for (Edu_u32 i = 0; i < EduRTOS_ArrayLength(Arg_MemoryPool->UsedBlocksBitmap); i++){
+		Arg_MemoryPool->UsedBlocksBitmap[i] = 0;
+	}
+
+	Arg_MemoryPool->UsedBlocks = 0;
+	Arg_MemoryPool->PeakUsedBlocks = 0;
+	Arg_MemoryPool->FailedAllocations = 0;
+	/*No tasks wait pool*/
+	EduRTOS_ListInit(&Arg_MemoryPool->WaitingTasksList);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+
+void *MemoryPoolAllocate(MemoryPool * const Arg_MemoryPool, const Edu_u32 Arg_TicksToWait){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		return EduRTOS_NULL;
+	}
+	/*If pool is empty, task is blocked (without using CPU) till block is freed and given to it or timeout.*/
+	return EduRTOS_TaskAllocate_MemoryPool(Arg_MemoryPool, Arg_TicksToWait);
+}
+
+
+void *MemoryPoolAllocateFromISR(MemoryPool * const Arg_MemoryPool){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		return EduRTOS_NULL;
+	}
+	return EduRTOS_TaskAllocate_MemoryPoolFromISR(Arg_MemoryPool);
+}
+
+
+EduRTOS_StdType_Status MemoryPoolFree(MemoryPool * const Arg_MemoryPool, void * const Arg_Block){
+	if ((EduRTOS_NULL == Arg_MemoryPool) || (Edu_True != MemoryPoolIsBlock(Arg_MemoryPool, Arg_Block))){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	/*Give block to highest priority waiting task, or return it to free list if no task waits pool (It fails if block is already free).*/
+	return EduRTOS_TaskFree_MemoryPool(Arg_MemoryPool, Arg_Block);
+}
+
+
+EduRTOS_StdType_Status MemoryPoolFreeFromISR(MemoryPool * const Arg_MemoryPool, void * const Arg_Block, Edu_Bool * const HigherPriorityTaskWoken){
+	if ((EduRTOS_NULL == Arg_MemoryPool) || (Edu_True != MemoryPoolIsBlock(Arg_MemoryPool, Arg_Block))){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	return EduRTOS_TaskFree_MemoryPoolFromISR(Arg_MemoryPool, Arg_Block, HigherPriorityTaskWoken);
+}
+
+
+EduRTOS_StdType_Status MemoryPoolGetStats(MemoryPool * const Arg_MemoryPool, MemoryPoolStats * const Arg_Stats){
+	if ((EduRTOS_NULL == Arg_MemoryPool) || (EduRTOS_NULL == Arg_Stats)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	/*Statistics are read together, So they are consistent with each other.*/
+	EduRTOS_EnterCritical();
+	Arg_Stats->BlockSize = Arg_MemoryPool->BlockSize;
+	Arg_Stats->NumberOfBlocks = Arg_MemoryPool->NumberOfBlocks;
+	Arg_Stats->UsedBlocks = Arg_MemoryPool->UsedBlocks;
+	Arg_Stats->PeakUsedBlocks = Arg_MemoryPool->PeakUsedBlocks;
+	Arg_Stats->FailedAllocations = Arg_MemoryPool->FailedAllocations;
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+#endif
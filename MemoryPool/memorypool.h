@@ -0,0 +1,125 @@
+/*
+ * File Name --> memorypool.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides API for Memory pool (fixed size blocks).
+ * */
+
+#ifndef MEMORYPOOL_H_
+#define MEMORYPOOL_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+#include "List/list.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Memory pool defines
+==================================================
+ */
+
+/*Block size is rounded up to multiple of this alignment, So each free block can hold address of next free block.*/
+#define 	EduRTOS_MEMORY_POOL_ALIGNMENT		sizeof(void *)
+
+typedef struct{
+	/*Head of free blocks, First word of each free block holds address of next free block (NULL at last one).*/
+	void *FreeList;
+	/*Buffer given by application, It's divided into NumberOfBlocks blocks of BlockSize bytes.*/
+	Edu_u8 *Buffer;
+	Edu_u32 BlockSize;
+	Edu_u32 NumberOfBlocks;
+	/*Bit for each block, It's set while block is allocated, So block that is freed twice is detected.*/
+	Edu_u32 UsedBlocksBitmap[(EduRTOS_Config_MEMORY_POOL_MAX_BLOCKS + 31) / 32];
+	/*Statistics of pool.*/
+	Edu_u32 UsedBlocks;
+	Edu_u32 PeakUsedBlocks;
+	Edu_u32 FailedAllocations;
+	/*Tasks blocked on this pool sorted by priority, Freed block is given to the head one.*/
+	EduRTOS_List WaitingTasksList;
+}MemoryPool;
+
+/*Snapshot of statistics of memory pool, It's filled by MemoryPoolGetStats.*/
+typedef struct{
+	Edu_u32 BlockSize;
+	Edu_u32 NumberOfBlocks;
+	/*Number of allocated blocks now.*/
+	Edu_u32 UsedBlocks;
+	/*Maximum number of allocated blocks at the same time since initialization.*/
+	Edu_u32 PeakUsedBlocks;
+	/*Number of allocations that returned NULL (pool was empty till timeout).*/
+	Edu_u32 FailedAllocations;
+}MemoryPoolStats;
+/*
+==================================================
+  End Section --> Memory pool defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  					--> Initialize Memory pool, Buffer is divided into blocks and all of them are free.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Arg_Buffer 		--> Buffer of blocks, It must be aligned by EduRTOS_MEMORY_POOL_ALIGNMENT and it's used only by pool.
+ * @param  Arg_BufferSize 	--> Size of buffer in bytes.
+ * @param  Arg_BlockSize 	--> Size of each block in bytes, It's rounded up to multiple of EduRTOS_MEMORY_POOL_ALIGNMENT.
+ * @retval --> EduRTOS_StdType_Status_Fail if any pointer is NULL, buffer isn't aligned, it can't hold one block
+ * or it holds more than EduRTOS_Config_MEMORY_POOL_MAX_BLOCKS blocks.
+ * */
+EduRTOS_StdType_Status MemoryPoolInit(MemoryPool * const Arg_MemoryPool, void * const Arg_Buffer,
+		const Edu_u32 Arg_BufferSize, const Edu_u32 Arg_BlockSize);
+
+/* @brief  					--> Allocate block, If pool is empty task is blocked till block is freed or timeout.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Arg_TicksToWait 	--> Timeout value (0 to return immediately, EduRTOS_INFINITE to wait forever).
+ * @retval --> Address of block, or NULL if timeout is passed.
+ * */
+void *MemoryPoolAllocate(MemoryPool * const Arg_MemoryPool, const Edu_u32 Arg_TicksToWait);
+
+/* @brief  					--> Allocate block from interrupt handler, It never blocks.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @retval --> Address of block, or NULL if pool is empty.
+ * */
+void *MemoryPoolAllocateFromISR(MemoryPool * const Arg_MemoryPool);
+
+/* @brief  					--> Free block, It's given to highest priority waiting task if any task waits pool.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Arg_Block 		--> Address of block returned by allocation from the same pool.
+ * @retval --> EduRTOS_StdType_Status_Fail if block isn't a block of pool or it's already free, Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+EduRTOS_StdType_Status MemoryPoolFree(MemoryPool * const Arg_MemoryPool, void * const Arg_Block);
+
+/* @brief  							--> Free block from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_MemoryPool 			--> Pointer of memory pool.
+ * @param  Arg_Block 				--> Address of block returned by allocation from the same pool.
+ * @param  HigherPriorityTaskWoken 	--> Set to Edu_True if higher priority task is woken up, Pass it to EduRTOS_YieldFromISR at end of handler.
+ * @retval --> Same as MemoryPoolFree.
+ * */
+EduRTOS_StdType_Status MemoryPoolFreeFromISR(MemoryPool * const Arg_MemoryPool, void * const Arg_Block, Edu_Bool * const HigherPriorityTaskWoken);
+
+/* @brief  					--> Get snapshot of statistics of memory pool.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Arg_Stats 		--> Pointer of statistics that is filled.
+ * @retval --> Status if statistics are filled or not.
+ * */
+EduRTOS_StdType_Status MemoryPoolGetStats(MemoryPool * const Arg_MemoryPool, MemoryPoolStats * const Arg_Stats);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+#endif /* MEMORYPOOL_H_ */
@@ -15,83 +15,53 @@ EduRTOS_StdType_Status MutexInit (Mutex * const Arg_Mutex_pMutex){
 	}
 	/*Initialize in released state (unlocked)*/
 	Arg_Mutex_pMutex->Mutex_State = EduRTOS_Mutex_State_Unlocked;
+	/*No tasks wait mutex*/
+	EduRTOS_ListInit(&Arg_Mutex_pMutex->WaitingTasksList);
+	EduRTOS_ListItemInit(&Arg_Mutex_pMutex->HeldListItem, Arg_Mutex_pMutex);
+	Arg_Mutex_pMutex->Protocol = EduRTOS_Mutex_Protocol_PriorityInheritance;
+	Arg_Mutex_pMutex->CeilingPriority = 0;
 	/*Task that locks Mutex, It's the only task  that can release it*/
 	return EduRTOS_StdType_Status_Succeed;
 }
 
-
-EduRTOS_StdType_Status MutexLock (Mutex * const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait){
-	if (EduRTOS_NULL == Arg_Mutex_pMutex){
+EduRTOS_StdType_Status MutexInitWithCeiling (Mutex * const Arg_Mutex_pMutex, const Edu_u32 Arg_CeilingPriority){
+	if (EduRTOS_StdType_Status_Succeed != MutexInit(Arg_Mutex_pMutex)){
 		return EduRTOS_StdType_Status_Fail;
 	}
-	/*If Mutex is already locked, block task till mutex is released.*/
-	if(EduRTOS_Mutex_State_Locked == __LDREXW( (Edu_u32 *) &Arg_Mutex_pMutex->Mutex_State)){
-		/*Block current*/
-		EduRTOS_TaskBlock_Mutex(Arg_Mutex_pMutex);
-	}
-
-	/* Calculate Maximum number of ticks that can task wait, till it's unlocked.
-	 * For example, assume current tick number is 50 and Arg_TicksToWait = 60,
-	 * So Mutex will fail to lock when system ticks = (60+50) = 120
-	 * */
-	const Edu_u32 WaitToTicks = Arg_TicksToWait + EduRTOS_GetCurrentTickNumber();
-	while(1){
-
-		/*Check whether time to lock, exceed configured time or not.*/
-		if ((Arg_TicksToWait != EduRTOS_INFINITE) && (WaitToTicks > EduRTOS_GetCurrentTickNumber())){
-			return EduRTOS_StdType_Status_Timeout;
-		}
-
-		/*Exclusive load of mutex value*/
-		if (EduRTOS_Mutex_State_Unlocked == __LDREXW( (Edu_u32 *) &Arg_Mutex_pMutex->Mutex_State)){
-			/*Exclusive store mutex value*/
-			if (0 == __STREXW(EduRTOS_Mutex_State_Locked,(Edu_u32 *)  &Arg_Mutex_pMutex->Mutex_State)){
-				__DMB();
-				/*Store task id that locked mutex.*/
-				Arg_Mutex_pMutex->TaskLockId = EduRTOS_GetCurrentRunningTask();
-				break;
-			}
-		}
+	if (Arg_CeilingPriority > EduRTOS_Config_MAX_PRIORITY){
+		return EduRTOS_StdType_Status_Fail;
 	}
+	Arg_Mutex_pMutex->Protocol = EduRTOS_Mutex_Protocol_PriorityCeiling;
+	Arg_Mutex_pMutex->CeilingPriority = Arg_CeilingPriority;
 	return EduRTOS_StdType_Status_Succeed;
 }
 
 
-EduRTOS_StdType_Status MutexRelease(Mutex *const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait){
+EduRTOS_StdType_Status MutexLock (Mutex * const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait){
 	if (EduRTOS_NULL == Arg_Mutex_pMutex){
 		return EduRTOS_StdType_Status_Fail;
 	}
-	/* Calculate Maximum number of ticks that can task wait, till it's unlocked.
+	/* If Mutex is already locked, task is blocked (without using CPU) till mutex is handed over to it
+	 * or Arg_TicksToWait ticks are passed, while holder of mutex inherits priority of task.
 	 * For example, assume current tick number is 50 and Arg_TicksToWait = 60,
-	 * So Mutex will fail to release when system ticks = (60+50) = 120
+	 * So Mutex will fail to lock when system ticks = (60+50) = 110
 	 * */
-	const Edu_u32 WaitToTicks = Arg_TicksToWait + EduRTOS_GetCurrentTickNumber();
+	return EduRTOS_TaskLock_Mutex(Arg_Mutex_pMutex, Arg_TicksToWait);
+}
 
-	while(1){
-		/*Check whether time to lock, exceed configured time or not.*/
-		if ((Arg_TicksToWait != EduRTOS_INFINITE) && (WaitToTicks > EduRTOS_GetCurrentTickNumber())){
-			return EduRTOS_StdType_Status_Timeout;
-		}
-		__DMB();
-		/*It it was unlocked, no other operations needed so return EduRTOS_StdType_Status_Succeed*/
-		if (EduRTOS_Mutex_State_Unlocked == Arg_Mutex_pMutex->Mutex_State ){
-			/*Unblock tasks that was blocked due to mutex's lock*/
-			EduRTOS_TaskUnBlock_Mutex(Arg_Mutex_pMutex);
-			return EduRTOS_StdType_Status_Succeed;
-		}
 
-		if (EduRTOS_GetCurrentRunningTask() == __LDREXW(&Arg_Mutex_pMutex->TaskLockId)){
-			if (EduRTOS_Mutex_State_Locked == __LDREXW(( Edu_u32 * )&Arg_Mutex_pMutex->Mutex_State)){
-				/*Unlock mutex*/
-				Arg_Mutex_pMutex->Mutex_State = EduRTOS_Mutex_State_Unlocked;
-			}
-			/*Unblock tasks that was blocked due to mutex's lock*/
-			EduRTOS_TaskUnBlock_Mutex(Arg_Mutex_pMutex);
-			return EduRTOS_StdType_Status_Succeed;
-		}
+EduRTOS_StdType_Status MutexRelease(Mutex *const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait){
+	if (EduRTOS_NULL == Arg_Mutex_pMutex){
+		return EduRTOS_StdType_Status_Fail;
 	}
+	/*Releasing mutex never blocks, so Arg_TicksToWait isn't used.*/
+	(void)Arg_TicksToWait;
+
+	/* Unlock mutex if it's locked by current task, restore priority of current task
+	 * and hand mutex over to highest priority waiting task.*/
+	return EduRTOS_TaskUnLock_Mutex(Arg_Mutex_pMutex);
 }
 
 EduMutex_State GetMutexStatus(Mutex * const Arg_Mutex_pMutex){
-	return __LDREXW(( Edu_u32 * )&Arg_Mutex_pMutex->Mutex_State);
+	return *((volatile EduMutex_State *)&Arg_Mutex_pMutex->Mutex_State);
 }
@@ -15,6 +15,7 @@
  */
 #include "EduRTOS_Config.h"
 #include "EduRTOS_defines.h"
+#include "List/list.h"
 /*
 ==================================================
   End Section --> File Includes
@@ -31,9 +32,26 @@ typedef enum{
 	EduRTOS_Mutex_State_Unlocked,
 }EduMutex_State;
 
+/*
+ * Protocol used to avoid priority inversion.
+ * Priority inheritance --> Task that holds mutex inherits priority of the highest priority task blocked on mutex.
+ * Priority ceiling 	--> Task that holds mutex runs at ceiling priority of mutex (Priority of highest priority task that uses mutex).
+ * */
+typedef enum{
+	EduRTOS_Mutex_Protocol_PriorityInheritance,
+	EduRTOS_Mutex_Protocol_PriorityCeiling,
+}EduMutex_Protocol;
+
 typedef struct {
 	EduMutex_State Mutex_State;
 	Edu_u32 TaskLockId;
+	/*Tasks blocked on this mutex sorted by priority.*/
+	EduRTOS_List WaitingTasksList;
+	EduMutex_Protocol Protocol;
+	/*Used only with priority ceiling protocol.*/
+	Edu_u32 CeilingPriority;
+	/*Links mutex in list of mutexes held by task that locks it.*/
+	EduRTOS_ListItem HeldListItem;
 }Mutex;
 /*
 ==================================================
@@ -47,23 +65,30 @@ typedef struct {
 ==================================================
  */
 
-/* @brief  					--> Initialize Mutex.
+/* @brief  					--> Initialize Mutex that uses priority inheritance protocol.
  * @param  Arg_Mutex_pMutex --> Pointer of Mutex.
  * @retval --> Status if it's initialized successfully or not.
  * */
 EduRTOS_StdType_Status MutexInit (Mutex * const Arg_Mutex_pMutex);
 
-/* @brief  					--> Lock mutex.
+/* @brief  						--> Initialize Mutex that uses priority ceiling protocol.
+ * @param  Arg_Mutex_pMutex 	--> Pointer of Mutex.
+ * @param  Arg_CeilingPriority 	--> Ceiling priority, It mustn't be less than priority of any task that locks mutex.
+ * @retval --> Status if it's initialized successfully or not.
+ * */
+EduRTOS_StdType_Status MutexInitWithCeiling (Mutex * const Arg_Mutex_pMutex, const Edu_u32 Arg_CeilingPriority);
+
+/* @brief  					--> Lock mutex, If it's locked task is blocked till it's released or timeout.
  * @param  Arg_Mutex_pMutex --> Pointer of Mutex.
- * @param  Arg_TicksToWait  --> Timeout value for locking mutex.
- * @retval --> Status if mutex successfully locked or not.
+ * @param  Arg_TicksToWait  --> Timeout value for locking mutex (0 to return immediately, EduRTOS_INFINITE to wait forever).
+ * @retval --> EduRTOS_StdType_Status_Succeed if mutex is locked, EduRTOS_StdType_Status_Timeout if timeout is passed.
  * */
 EduRTOS_StdType_Status MutexLock (Mutex * const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait);
 
 /* @brief  					--> Release mutex.
  * @param  Arg_Mutex_pMutex --> Pointer of Mutex.
- * @param  Arg_TicksToWait  --> Timeout value for releasing mutex.
- * @retval --> Status if mutex successfully released or not.
+ * @param  Arg_TicksToWait  --> Not used, as releasing mutex never blocks.
+ * @retval --> Status if mutex successfully released or not (Mutex is locked by another task).
  * */
 EduRTOS_StdType_Status MutexRelease(Mutex *const Arg_Mutex_pMutex, const Edu_u32 Arg_TicksToWait);
 
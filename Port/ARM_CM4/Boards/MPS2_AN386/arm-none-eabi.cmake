@@ -0,0 +1,21 @@
+# Toolchain file of QEMU mps2-an386 board (Cortex-M4).
+# cmake -S . -B build-mps2 -DCMAKE_TOOLCHAIN_FILE=Port/ARM_CM4/Boards/MPS2_AN386/arm-none-eabi.cmake -DEDURTOS_CMSIS_DIR=<CMSIS_5>
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(CMAKE_C_COMPILER arm-none-eabi-gcc)
+set(CMAKE_ASM_COMPILER arm-none-eabi-gcc)
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+# Floating point uses FPU (Cortex-M4F), FPU registers are saved only for tasks that use it.
+# -DEDURTOS_FLOAT_ABI=soft compiles floating point as software.
+set(EDURTOS_FLOAT_ABI hard CACHE STRING "Floating point ABI (hard, softfp or soft)")
+if(EDURTOS_FLOAT_ABI STREQUAL "soft")
+    set(EDURTOS_FPU_FLAGS "-mfloat-abi=soft")
+else()
+    set(EDURTOS_FPU_FLAGS "-mfloat-abi=${EDURTOS_FLOAT_ABI} -mfpu=fpv4-sp-d16")
+endif()
+set(CMAKE_C_FLAGS_INIT "-mcpu=cortex-m4 -mthumb ${EDURTOS_FPU_FLAGS} -ffunction-sections -fdata-sections")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-specs=nano.specs -specs=nosys.specs -Wl,--gc-sections")
+
+set(EDURTOS_BOARD MPS2_AN386 CACHE STRING "Board of ARM Cortex-M4 port")
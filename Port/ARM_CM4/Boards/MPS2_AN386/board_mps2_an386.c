@@ -0,0 +1,92 @@
+/*
+ * File Name --> board_mps2_an386.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Board
+ * Brief	 --> Console of QEMU mps2-an386 machine, Output is written to UART0 (CMSDK APB UART) and
+ * exit status is passed to QEMU through semihosting, So printf and exit work as on host.
+ * */
+
+#include <stdint.h>
+
+/*
+==================================================
+  Start Section --> UART0 Registers
+==================================================
+ */
+#define 	EduRTOS_Board_UART0_BASE				0x40004000UL
+
+#define 	EduRTOS_Board_UART0_DATA				(*(volatile uint32_t *)(EduRTOS_Board_UART0_BASE + 0x00))
+#define 	EduRTOS_Board_UART0_STATE				(*(volatile uint32_t *)(EduRTOS_Board_UART0_BASE + 0x04))
+#define 	EduRTOS_Board_UART0_CTRL				(*(volatile uint32_t *)(EduRTOS_Board_UART0_BASE + 0x08))
+#define 	EduRTOS_Board_UART0_BAUDDIV				(*(volatile uint32_t *)(EduRTOS_Board_UART0_BASE + 0x10))
+
+#define 	EduRTOS_Board_UART_STATE_TX_FULL		(1UL << 0)
+#define 	EduRTOS_Board_UART_CTRL_TX_ENABLE		(1UL << 0)
+/*
+==================================================
+  End Section --> UART0 Registers
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Semihosting
+==================================================
+ */
+#define 	EduRTOS_Board_SEMIHOSTING_SYS_EXIT_EXTENDED		0x20
+#define 	EduRTOS_Board_ADP_STOPPED_APPLICATION_EXIT		0x20026
+/*
+==================================================
+  End Section --> Semihosting
+==================================================
+ */
+
+static void EduRTOS_Board_PutChar(const char Character){
+	/*UART is enabled on first use, as printf may be called before any initialization.*/
+	if (0 == (EduRTOS_Board_UART0_CTRL & EduRTOS_Board_UART_CTRL_TX_ENABLE)){
+		EduRTOS_Board_UART0_BAUDDIV = 16;
+		EduRTOS_Board_UART0_CTRL = EduRTOS_Board_UART_CTRL_TX_ENABLE;
+	}
+	while (EduRTOS_Board_UART0_STATE & EduRTOS_Board_UART_STATE_TX_FULL){
+
+	}
+	EduRTOS_Board_UART0_DATA = (uint32_t)Character;
+}
+
+/* @brief  		  --> System call used by C library to write output (stdout, stderr).
+ * @param  File   --> File descriptor (unused, all output goes to UART0).
+ * @param  Buffer --> Data to write.
+ * @param  Length --> Number of bytes.
+ * @retval --> Number of written bytes.
+ * */
+int _write(int File, const char *Buffer, int Length){
+	(void)File;
+	for (int i = 0; i < Length; i++){
+		if ('\n' == Buffer[i]){
+			EduRTOS_Board_PutChar('\r');
+		}
+		EduRTOS_Board_PutChar(Buffer[i]);
+	}
+	return Length;
+}
+
+/* @brief  		  --> System call used by exit, It stops QEMU with exit status (requires -semihosting).
+ * @param  Status --> Exit status.
+ * */
+void _exit(int Status){
+	uint32_t Parameters[2] = {EduRTOS_Board_ADP_STOPPED_APPLICATION_EXIT, (uint32_t)Status};
+
+	__asm volatile (
+		"	mov r0, %0		\n"
+		"	mov r1, %1		\n"
+		"	bkpt 0xAB		\n"
+		:
+		: "r" (EduRTOS_Board_SEMIHOSTING_SYS_EXIT_EXTENDED), "r" (Parameters)
+		: "r0", "r1", "memory"
+	);
+
+	while(1){
+
+	}
+}
@@ -0,0 +1,104 @@
+/*
+ * File Name --> startup_mps2_an386.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> Board
+ * Brief	 --> Vector table and reset handler of QEMU mps2-an386 (Cortex-M4) machine.
+ * */
+
+#include <stdint.h>
+#include "EduRTOS_Config.h"
+
+/*
+==================================================
+  Start Section --> Linker Symbols
+==================================================
+ */
+extern uint32_t _estack;
+/*Load address of .data section.*/
+extern uint32_t _sidata;
+extern uint32_t _sdata;
+extern uint32_t _edata;
+extern uint32_t _sbss;
+extern uint32_t _ebss;
+/*
+==================================================
+  End Section --> Linker Symbols
+==================================================
+ */
+
+int main(void);
+void __libc_init_array(void);
+void _exit(int Status);
+
+/*Frequency of processor clock (FPGA SYSCLK of mps2-an386).*/
+uint32_t SystemCoreClock = EduRTOS_Config_CLOCK_HZ;
+
+void SystemInit(void){
+#if defined(__FPU_USED) && (__FPU_USED == 1)
+	/*Full access to FPU (CP10 & CP11) before C library and main use it.*/
+	SCB->CPACR |= (3UL << 20) | (3UL << 22);
+	__DSB();
+	__ISB();
+#endif
+}
+
+void SystemCoreClockUpdate(void){
+	SystemCoreClock = EduRTOS_Config_CLOCK_HZ;
+}
+
+void Default_Handler(void){
+	while(1){
+
+	}
+}
+
+void Reset_Handler(void);
+void NMI_Handler(void)			__attribute__((weak, alias("Default_Handler")));
+void HardFault_Handler(void)	__attribute__((weak, alias("Default_Handler")));
+void MemManage_Handler(void)	__attribute__((weak, alias("Default_Handler")));
+void BusFault_Handler(void)		__attribute__((weak, alias("Default_Handler")));
+void UsageFault_Handler(void)	__attribute__((weak, alias("Default_Handler")));
+void SVC_Handler(void)			__attribute__((weak, alias("Default_Handler")));
+void DebugMon_Handler(void)		__attribute__((weak, alias("Default_Handler")));
+void PendSV_Handler(void)		__attribute__((weak, alias("Default_Handler")));
+void SysTick_Handler(void)		__attribute__((weak, alias("Default_Handler")));
+
+/*System exceptions and 32 external interrupts (Only system exceptions are used).*/
+__attribute__((section(".isr_vector"), used))
+void (* const EduRTOS_Board_VectorTable[16 + 32])(void) = {
+	(void (*)(void))&_estack,
+	Reset_Handler,
+	NMI_Handler,
+	HardFault_Handler,
+	MemManage_Handler,
+	BusFault_Handler,
+	UsageFault_Handler,
+	0,
+	0,
+	0,
+	0,
+	SVC_Handler,
+	DebugMon_Handler,
+	0,
+	PendSV_Handler,
+	SysTick_Handler,
+	[16 ... (16 + 32 - 1)] = Default_Handler,
+};
+
+void Reset_Handler(void){
+	/*Copy .data section from its load address, and clear .bss section.*/
+	uint32_t *Source = &_sidata;
+	for (uint32_t *Destination = &_sdata; Destination < &_edata; Destination++){
+		*Destination = *Source++;
+	}
+	for (uint32_t *Destination = &_sbss; Destination < &_ebss; Destination++){
+		*Destination = 0;
+	}
+
+	SystemInit();
+	/*Constructors of C library.*/
+	__libc_init_array();
+
+	_exit(main());
+}
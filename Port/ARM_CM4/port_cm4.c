@@ -0,0 +1,266 @@
+/*
+ * File Name --> port_cm4.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Port of EduRTOS for ARM Cortex-M4, SysTick is used as tick timer and PendSV for context switching.
+ * */
+
+#include "EduRTOS.h"
+#include "Port/port.h"
+
+#if EduRTOS_Config_PORT == EduRTOS_PORT_ARM_CM4
+
+volatile Edu_u32 EduRTOS_Port_CriticalNesting = 0;
+
+#if EduRTOS_USE_PORT_TIMESTAMP && (EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386)
+/*Number of SysTick periods, It extends SysTick counter to timestamp.*/
+static volatile Edu_u32 EduRTOS_Port_SysTickPeriods = 0;
+#endif
+
+void EduRTOS_Port_Init(void){
+	/* Set priority levels */
+	NVIC_SetPriority(SVCall_IRQn, 0);
+
+	/* Tick and PendSV run at lowest possible priority, So they never delay application interrupts,
+	 * and PendSV doesn't preempt tick handler (Context is switched after it by tail chaining). */
+	NVIC_SetPriority(SysTick_IRQn, EduRTOS_Port_KERNEL_INTERRUPT_PRIORITY);
+	NVIC_SetPriority(PendSV_IRQn, EduRTOS_Port_KERNEL_INTERRUPT_PRIORITY);
+
+	/* Enable SVC and PendSV interrupts */
+	NVIC_EnableIRQ(PendSV_IRQn);
+	NVIC_EnableIRQ(SVCall_IRQn);
+
+#if EduRTOS_USE_PORT_TIMESTAMP && (EduRTOS_Config_BOARD != EduRTOS_BOARD_MPS2_AN386)
+	/*Enable DWT cycle counter, It's port timestamp.*/
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+#if EduRTOS_Port_USE_FPU
+	/*Full access to FPU (CP10 & CP11), as tasks may use it.*/
+	SCB->CPACR |= (3UL << 20) | (3UL << 22);
+	__DSB();
+	__ISB();
+	/*
+	 * Automatic and lazy state preservation, Exception entry only reserves space of S0-S15 and FPSCR (CONTROL.FPCA is set),
+	 * and they are pushed when handler executes its first FPU instruction, So tasks that don't use FPU never save FPU registers.
+	 * */
+	FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
+#endif
+}
+
+Edu_uptr EduRTOS_Port_InitTaskStack(Edu_u8 * const StackTop, const Edu_u32 StackSize,
+		void (*TaskFunction) (), Edu_u32 const * const Parameters){
+
+	/*Initialize and reserve stack frame for task, as if it was saved by PendSV_Handler.*/
+	StackFrameM4WithoutFPU * const TaskStackFrame = (StackFrameM4WithoutFPU *)(StackTop - sizeof(StackFrameM4WithoutFPU));
+	TaskStackFrame->r4 	= 0;
+	TaskStackFrame->r5 	= 0;
+	TaskStackFrame->r6 	= 0;
+	TaskStackFrame->r7 	= 0;
+	TaskStackFrame->r8 	= 0;
+	TaskStackFrame->r9 	= 0;
+	TaskStackFrame->r10 = 0;
+	TaskStackFrame->r11 = 0;
+#if EduRTOS_Port_USE_FPU
+	TaskStackFrame->ExcReturn = EduRTOS_Port_EXC_RETURN_THREAD_PSP;
+#endif
+	if (EduRTOS_NULL != Parameters){
+		TaskStackFrame->r0  = Parameters[0];
+		TaskStackFrame->r1 	= Parameters[1];
+		TaskStackFrame->r2 	= Parameters[2];
+		TaskStackFrame->r3 	= Parameters[3];
+	}
+	else{
+		TaskStackFrame->r0  = 0;
+		TaskStackFrame->r1 	= 0;
+		TaskStackFrame->r2 	= 0;
+		TaskStackFrame->r3 	= 0;
+	}
+	TaskStackFrame->r12 = 0;
+	TaskStackFrame->pc 	= (Edu_u32)TaskFunction;
+	TaskStackFrame->lr 	= 0;
+	TaskStackFrame->psr	= 0x1000000;
+
+	/*Saved process stack pointer points to r4 of frame.*/
+	return (Edu_uptr)TaskStackFrame;
+}
+
+/* @brief  			   --> Restore context of first task and jump to its function.
+ * @param  StackPointer --> Saved stack pointer of first task (r0).
+ * */
+__attribute__ ((naked)) static void EduRTOS_Port_StartFirstTask(Edu_uptr StackPointer){
+	__asm volatile (
+		"	msr psp, r0			\n"
+		/*Switch control to process stack pointer*/
+		/*CONTROL.FPCA is cleared too, So first task starts without FPU context.*/
+		"	movs r0, #2			\n"
+		"	msr control, r0		\n"
+		"	isb					\n"
+		"	pop {r4-r11}		\n"
+#if EduRTOS_Port_USE_FPU
+		/*EXC_RETURN of frame isn't used, as first task isn't started by exception return.*/
+		"	add sp, sp, #4		\n"
+#endif
+		"	pop {r0-r3}			\n"
+		"	pop {r12}			\n"
+		"	pop {lr}			\n"
+		"	pop {pc}			\n"
+	);
+}
+
+void EduRTOS_Port_StartScheduler(void){
+	/*Tick starts with scheduler, So SysTick_Handler never runs before first task.*/
+	SysTick_Config(EduRTOS_SystickReloadTicks);
+	EduRTOS_Port_StartFirstTask(EduRTOS_CurrentTCB->pStackPointer);
+}
+
+void EduRTOS_Port_Halt(void){
+	/*Kernel interrupts are stopped, Interrupts above EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY keep running (like motor control).*/
+	__set_BASEPRI(EduRTOS_Port_MAX_SYSCALL_BASEPRI);
+	while(1){
+
+	}
+}
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+Edu_u32 EduRTOS_Port_SuppressTicksAndSleep(const Edu_u32 ExpectedIdleTicks, Edu_u64 * const SleepCounts){
+	/*Stop SysTick, and program it to fire at expected wakeup tick.*/
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	/*Tick is already pending, so it's late to sleep.*/
+	if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)){
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		return 0;
+	}
+
+	/*Remaining counts of current tick + counts of the other idle ticks.*/
+	const Edu_u32 SleepReload = SysTick->VAL + (EduRTOS_SystickReloadTicks * (ExpectedIdleTicks - 1));
+	SysTick->LOAD = SleepReload;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	/*
+	 * Interrupts masked by BASEPRI don't wake up WFI, So they are masked by PRIMASK while sleeping,
+	 * and BASEPRI masking is restored before any handler can run.
+	 * */
+	__disable_irq();
+	__set_BASEPRI(0);
+	__DSB();
+	__WFI();
+	__set_BASEPRI(EduRTOS_Port_MAX_SYSCALL_BASEPRI);
+	__enable_irq();
+	__ISB();
+
+	/*Wake up, by SysTick or by other interrupt (Its handler runs after leaving critical section).*/
+	const Edu_u32 IsTickExpired = SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk;
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	Edu_u32 CompletedTicks;
+	if (IsTickExpired){
+		/* SysTick interrupt is pending and it will count the last tick,
+		 * Timer is reloaded and continued counting, so next tick is shortened by these counts.*/
+		const Edu_u32 CountsAfterExpiry = SleepReload - SysTick->VAL;
+		Edu_u32 NextTickReload = (EduRTOS_SystickReloadTicks - 1) - CountsAfterExpiry;
+		if (CountsAfterExpiry >= (EduRTOS_SystickReloadTicks - 1)){
+			NextTickReload = EduRTOS_SystickReloadTicks - 1;
+		}
+		SysTick->LOAD = NextTickReload;
+		CompletedTicks = ExpectedIdleTicks - 1;
+		*SleepCounts += SleepReload + CountsAfterExpiry;
+	}
+	else{
+		/*Counts from last tick (before sleep) till wake up.*/
+		const Edu_u32 CompletedCounts = (ExpectedIdleTicks * EduRTOS_SystickReloadTicks) - SysTick->VAL;
+		CompletedTicks = CompletedCounts / EduRTOS_SystickReloadTicks;
+		/*Next tick happens at the end of the current tick period.*/
+		SysTick->LOAD = ((CompletedTicks + 1) * EduRTOS_SystickReloadTicks) - CompletedCounts;
+		*SleepCounts += SleepReload - SysTick->VAL;
+	}
+
+	/*Restart SysTick, and restore its periodic reload after next tick.*/
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = EduRTOS_SystickReloadTicks - 1;
+
+	return CompletedTicks;
+}
+#endif
+
+#if EduRTOS_USE_PORT_TIMESTAMP && (EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386)
+/*Note in tickless idle mode SysTick period is changed while sleeping, so timestamps of sleep periods aren't accurate.*/
+Edu_u32 EduRTOS_Port_SysTickTimestamp(void){
+	const Edu_u32 BasePri = __get_BASEPRI();
+	__set_BASEPRI_MAX(EduRTOS_Port_MAX_SYSCALL_BASEPRI);
+	__ISB();
+	Edu_u32 Periods = EduRTOS_Port_SysTickPeriods;
+	const Edu_u32 Value = SysTick->VAL;
+	/*Counter has wrapped around but SysTick_Handler hasn't run yet (Timestamp is read with SysTick masked).*/
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && (Value > (EduRTOS_SystickReloadTicks / 2))){
+		Periods++;
+	}
+	__set_BASEPRI(BasePri);
+	return (Periods * EduRTOS_SystickReloadTicks) + ((EduRTOS_SystickReloadTicks - 1) - Value);
+}
+#endif
+
+void SysTick_Handler(void){
+	/*SysTick has the lowest priority, So kernel interrupts that call FromISR APIs are masked while lists of kernel are updated.*/
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+#if EduRTOS_USE_PORT_TIMESTAMP && (EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386)
+	EduRTOS_Port_SysTickPeriods++;
+#endif
+	if (Edu_True == EduRTOS_TickIncrement()){
+		EduRTOS_Port_ContextSwitchingTrigger();
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+}
+
+/*
+ * Context of task is r4-r11 (pushed by software) and exception frame (pushed by hardware) on its stack,
+ * So only process stack pointer is saved in TCB (pStackPointer is first member of TCB).
+ * Next task is already selected by kernel (EduRTOS_NextTCB), So handler only saves, swaps TCB pointer and restores,
+ * without calling kernel or disabling interrupts. EduRTOS_CurrentTCB is written only here, and if kernel changes
+ * EduRTOS_NextTCB after it's read, PendSV is pended again and switches to the new task.
+ * With FPU, EXC_RETURN is saved in context of task, Its bit 4 is cleared only if task has used FPU (extended frame),
+ * So S16-S31 are saved and restored only for these tasks. "vstmdb" also makes lazy stacking of S0-S15 happen.
+ * */
+__attribute__ ((naked)) void PendSV_Handler(void){
+	__asm volatile (
+		"	mrs r0, psp					\n"
+#if EduRTOS_Port_USE_FPU
+		"	tst lr, #0x10				\n"
+		"	it eq						\n"
+		"	vstmdbeq r0!, {s16-s31}		\n"
+		"	stmdb r0!, {r4-r11, lr}		\n"
+#else
+		"	stmdb r0!, {r4-r11}			\n"
+#endif
+		/*Save stack pointer in TCB of switched out task.*/
+		"	ldr r3, CurrentTCBConst		\n"
+		"	ldr r2, [r3]				\n"
+		"	str r0, [r2]				\n"
+		/*EduRTOS_CurrentTCB = EduRTOS_NextTCB*/
+		"	ldr r1, NextTCBConst		\n"
+		"	ldr r2, [r1]				\n"
+		"	str r2, [r3]				\n"
+		"	ldr r0, [r2]				\n"
+#if EduRTOS_Port_USE_FPU
+		"	ldmia r0!, {r4-r11, lr}		\n"
+		"	tst lr, #0x10				\n"
+		"	it eq						\n"
+		"	vldmiaeq r0!, {s16-s31}		\n"
+#else
+		"	ldmia r0!, {r4-r11}			\n"
+#endif
+		"	msr psp, r0					\n"
+		"	bx lr						\n"
+		"	.align 2					\n"
+		"CurrentTCBConst: .word EduRTOS_CurrentTCB	\n"
+		"NextTCBConst: .word EduRTOS_NextTCB		\n"
+	);
+}
+
+#endif
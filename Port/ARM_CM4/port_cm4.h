@@ -0,0 +1,169 @@
+/*
+ * File Name --> port_cm4.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Port macros for ARM Cortex-M4 (CMSIS).
+ * */
+
+#ifndef EDUCATIONALRTOS_PORT_CM4_H_
+#define EDUCATIONALRTOS_PORT_CM4_H_
+
+/*
+ * FPU context is saved only when code is compiled for hardware FPU (-mfloat-abi=hard or softfp) and device has FPU,
+ * CMSIS defines __FPU_USED in this case. Otherwise context switching is the same as Cortex-M4 without FPU.
+ * */
+#if defined(__FPU_USED) && (__FPU_USED == 1)
+#define 	EduRTOS_Port_USE_FPU					1
+#else
+#define 	EduRTOS_Port_USE_FPU					0
+#endif
+
+/*
+==================================================
+  Start Section --> Data Type Declaration
+==================================================
+ */
+typedef struct {
+	/*Pushed by software*/
+	Edu_u32 r4;
+	Edu_u32 r5;
+	Edu_u32 r6;
+	Edu_u32 r7;
+	Edu_u32 r8;
+	Edu_u32 r9;
+	Edu_u32 r10;
+	Edu_u32 r11;
+#if EduRTOS_Port_USE_FPU
+	/*
+	 * EXC_RETURN of task, Its bit 4 is cleared when task has used FPU, Then S16-S31 are saved (by software) below this frame
+	 * and hardware frame is extended by S0-S15 and FPSCR. New task hasn't used FPU, So it starts with basic frame.
+	 * */
+	Edu_u32 ExcReturn;
+#endif
+
+	/*Pushed by hardware*/
+	Edu_u32 r0;
+	Edu_u32 r1;
+	Edu_u32 r2;
+	Edu_u32 r3;
+	Edu_u32 r12;
+	Edu_u32 lr;
+	Edu_u32 pc;
+	Edu_u32 psr;
+}StackFrameM4WithoutFPU;
+/*
+==================================================
+  End Section --> Data Type Declaration
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Port Macros
+==================================================
+ */
+
+#if (EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY == 0) || (EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY >= (1UL << __NVIC_PRIO_BITS))
+#error "EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY must be from 1 to (2^__NVIC_PRIO_BITS - 1)"
+#endif
+
+/*BASEPRI value that masks kernel interrupts (Priority is stored in high bits of priority byte).*/
+#define 	EduRTOS_Port_MAX_SYSCALL_BASEPRI		(EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - __NVIC_PRIO_BITS))
+
+/*Tick (SysTick) and context switching (PendSV) interrupts.*/
+#define 	EduRTOS_Port_KERNEL_INTERRUPT_PRIORITY	((1UL << __NVIC_PRIO_BITS) - 1)
+
+#define 	EduRTOS_EnterCritical()					EduRTOS_Port_EnterCritical()
+#define 	EduRTOS_ExitCritical()					EduRTOS_Port_ExitCritical()
+#define 	EduRTOS_EnterCriticalFromISR()			EduRTOS_Port_EnterCriticalFromISR()
+#define 	EduRTOS_ExitCriticalFromISR(SavedMask)	EduRTOS_Port_ExitCriticalFromISR(SavedMask)
+
+#define 	EduRTOS_Port_ContextSwitchingTrigger()	do{ SCB->ICSR = SCB_ICSR_PENDSVSET_Msk; __DSB(); }while(0)
+
+#define 	EduRTOS_Port_CountLeadingZeros(Value)	__CLZ(Value)
+
+/*Stack pointer must be 8-byte aligned (AAPCS).*/
+#define 	EduRTOS_Port_StackSize(Size)			(((Size) + 7UL) & ~7UL)
+
+#define 	EduRTOS_Port_TIMER_COUNTS_PER_TICK		EduRTOS_SystickReloadTicks
+
+/*SysTick is 24-bit timer.*/
+#define 	EduRTOS_Port_MAX_SUPPRESSED_TICKS		(SysTick_LOAD_RELOAD_Msk / EduRTOS_SystickReloadTicks)
+
+#define 	EduRTOS_TASKS_STACK_TOP					((Edu_u8 *)(EduRTOS_Config_OS_STACK_TOP-EduRTOS_Config_OS_STACK_SIZE))
+#define 	EduRTOS_TASKS_STACK_REGION_SIZE			EduRTOS_Config_TASKS_STACK_REGION_SIZE
+/*Heap is below tasks stack region.*/
+#define 	EduRTOS_HEAP_START						(EduRTOS_TASKS_STACK_TOP - EduRTOS_TASKS_STACK_REGION_SIZE - EduRTOS_Config_HEAP_SIZE)
+#define 	EduRTOS_HEAP_SIZE						EduRTOS_Config_HEAP_SIZE
+#if EduRTOS_Config_BOARD == EduRTOS_BOARD_MPS2_AN386
+/*QEMU doesn't implement DWT cycle counter, so timestamp is SysTick counts extended by number of SysTick periods.*/
+Edu_u32 EduRTOS_Port_SysTickTimestamp(void);
+#define 	EduRTOS_Port_Timestamp()				EduRTOS_Port_SysTickTimestamp()
+#else
+#define 	EduRTOS_Port_Timestamp()				(DWT->CYCCNT)
+#endif
+#define 	EduRTOS_Port_TIMESTAMP_HZ				EduRTOS_Config_CLOCK_HZ
+
+/*EXC_RETURN of task that hasn't used FPU (Return to thread mode, process stack, basic frame).*/
+#define 	EduRTOS_Port_EXC_RETURN_THREAD_PSP		0xFFFFFFFDUL
+/*
+==================================================
+  End Section --> Port Macros
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Critical Sections
+==================================================
+ */
+
+/*Number of nested critical sections, Context is switched only when it's 0 so it isn't part of task context.*/
+extern volatile Edu_u32 EduRTOS_Port_CriticalNesting;
+
+/* @brief  --> Mask interrupts that call kernel (Tick, PendSV and interrupts up to EduRTOS_Config_MAX_SYSCALL_INTERRUPT_PRIORITY),
+ * Interrupts of higher priority keep running. Critical sections can be nested.
+ * */
+static inline __attribute__((always_inline)) void EduRTOS_Port_EnterCritical(void){
+	__set_BASEPRI(EduRTOS_Port_MAX_SYSCALL_BASEPRI);
+	__DSB();
+	__ISB();
+	EduRTOS_Port_CriticalNesting++;
+}
+
+/* @brief  --> Leave critical section, Interrupts are unmasked when the outermost critical section is left.
+ * ISB makes sure that pending PendSV is taken right after unmasking.
+ * */
+static inline __attribute__((always_inline)) void EduRTOS_Port_ExitCritical(void){
+	EduRTOS_Port_CriticalNesting--;
+	if (0 == EduRTOS_Port_CriticalNesting){
+		__set_BASEPRI(0);
+		__ISB();
+	}
+}
+
+/* @brief  --> Mask kernel interrupts inside interrupt handler, Nesting isn't counted as previous mask is returned.
+ * @retval --> Previous BASEPRI, It's passed to EduRTOS_Port_ExitCriticalFromISR.
+ * */
+static inline __attribute__((always_inline)) Edu_u32 EduRTOS_Port_EnterCriticalFromISR(void){
+	const Edu_u32 BasePri = __get_BASEPRI();
+	__set_BASEPRI_MAX(EduRTOS_Port_MAX_SYSCALL_BASEPRI);
+	__DSB();
+	__ISB();
+	return BasePri;
+}
+
+/* @brief  		   --> Restore mask of interrupts that was saved by EduRTOS_Port_EnterCriticalFromISR.
+ * @param  BasePri --> Previous BASEPRI.
+ * */
+static inline __attribute__((always_inline)) void EduRTOS_Port_ExitCriticalFromISR(const Edu_u32 BasePri){
+	__set_BASEPRI(BasePri);
+}
+/*
+==================================================
+  End Section --> Critical Sections
+==================================================
+ */
+
+#endif /* EDUCATIONALRTOS_PORT_CM4_H_ */
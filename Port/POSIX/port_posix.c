@@ -0,0 +1,257 @@
+/*
+ * File Name --> port_posix.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Port of EduRTOS for Linux (POSIX) host, It's used to test and benchmark kernel without board.
+ * Each task has its own ucontext on its stack, SIGALRM of interval timer is used as tick interrupt
+ * and blocking SIGALRM is used as disabling interrupts.
+ * */
+
+#include "EduRTOS_Config.h"
+
+#if EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "EduRTOS.h"
+#include "Port/port.h"
+
+/*
+ * Context of task, It's stored at top of task stack and its address is stored in pStackPointer of task TCB.
+ * */
+typedef struct {
+	ucontext_t Context;
+	void (*Function) ();
+	Edu_u32 Parameters[4];
+}EduRTOS_Port_TaskContext;
+
+Edu_u8 EduRTOS_Port_StackRegion[EduRTOS_Port_STACK_REGION_SIZE] __attribute__((aligned(16)));
+#if EduRTOS_Config_USE_HEAP
+Edu_u8 EduRTOS_Port_HeapRegion[EduRTOS_Config_HEAP_SIZE] __attribute__((aligned(16)));
+#endif
+
+/*Signals that are blocked while interrupts are disabled.*/
+static sigset_t EduRTOS_Port_TickSignalSet;
+
+/*Mirrors blocking of tick signal, as it's cheaper than asking kernel about signal mask.*/
+static volatile sig_atomic_t EduRTOS_Port_InterruptsDisabled = 0;
+
+/*
+ * Number of nested critical sections, Interrupts are enabled when the outermost one is left.
+ * Tick handler may switch tasks while idle task sleeps inside critical section, So it's saved with context of task.
+ * */
+static volatile Edu_u32 EduRTOS_Port_CriticalNesting = 0;
+
+/*Context switching is requested while interrupts are disabled, It's done once they are enabled (Like PendSV).*/
+static volatile sig_atomic_t EduRTOS_Port_ContextSwitchingPending = 0;
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+/*Time of last tick signal, used to measure sleep time.*/
+static struct timespec EduRTOS_Port_LastTickTime;
+#endif
+
+#define EduRTOS_Port_TaskContextOf(TCB)		((EduRTOS_Port_TaskContext *)(TCB)->pStackPointer)
+
+/* @brief  --> Switch from current task to task selected by kernel, It must be called while interrupts are disabled.
+ * Function returns when current task is switched in again.
+ * */
+static void EduRTOS_Port_SwitchTask(void){
+	EduRTOS_Port_TaskContext * const CurrentTaskContext = EduRTOS_Port_TaskContextOf(EduRTOS_CurrentTCB);
+
+	EduRTOS_Port_ContextSwitchingPending = 0;
+	/*Next task is already selected by kernel.*/
+	EduRTOS_CurrentTCB = EduRTOS_NextTCB;
+
+	EduRTOS_Port_TaskContext * const NextTaskContext = EduRTOS_Port_TaskContextOf(EduRTOS_CurrentTCB);
+	if (CurrentTaskContext != NextTaskContext){
+		const Edu_u32 CriticalNesting = EduRTOS_Port_CriticalNesting;
+		swapcontext(&CurrentTaskContext->Context, &NextTaskContext->Context);
+		EduRTOS_Port_CriticalNesting = CriticalNesting;
+	}
+}
+
+/* @brief  --> Entry of all tasks, It calls task function with its parameters.
+ * */
+static void EduRTOS_Port_TaskEntry(void){
+	EduRTOS_Port_TaskContext * const TaskContext = EduRTOS_Port_TaskContextOf(EduRTOS_CurrentTCB);
+
+	/*Task starts with interrupts enabled (Signal mask of its context is empty).*/
+	EduRTOS_Port_InterruptsDisabled = 0;
+	EduRTOS_Port_CriticalNesting = 0;
+
+	/*Parameters are passed as four 32-bit values, like r0-r3 of ARM port.*/
+	((void (*)(Edu_u32, Edu_u32, Edu_u32, Edu_u32))TaskContext->Function)(
+			TaskContext->Parameters[0], TaskContext->Parameters[1],
+			TaskContext->Parameters[2], TaskContext->Parameters[3]);
+
+	/*Task function must never return.*/
+	EduRTOS_ErrorHandler();
+}
+
+/* @brief  		  --> Handler of tick signal, It's the same as SysTick_Handler of ARM port.
+ * @param  Signal --> Number of signal (SIGALRM).
+ * */
+static void EduRTOS_Port_TickHandler(int Signal){
+	(void)Signal;
+	/*Tick signal is blocked while handler runs, It's the same as running inside critical section.
+	 * Handler may interrupt sleep of idle task that is inside critical section, so old state is restored.*/
+	const sig_atomic_t WereInterruptsDisabled = EduRTOS_Port_InterruptsDisabled;
+	EduRTOS_Port_InterruptsDisabled = 1;
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+	clock_gettime(CLOCK_MONOTONIC, &EduRTOS_Port_LastTickTime);
+#endif
+
+	if (Edu_True == EduRTOS_TickIncrement()){
+		EduRTOS_Port_ContextSwitchingPending = 1;
+	}
+	if (EduRTOS_Port_ContextSwitchingPending){
+		EduRTOS_Port_SwitchTask();
+	}
+
+	/*Signal mask of interrupted task is restored once handler returns.*/
+	EduRTOS_Port_InterruptsDisabled = WereInterruptsDisabled;
+}
+
+void EduRTOS_Port_DisableInterrupts(void){
+	sigprocmask(SIG_BLOCK, &EduRTOS_Port_TickSignalSet, EduRTOS_NULL);
+	EduRTOS_Port_InterruptsDisabled = 1;
+	EduRTOS_Port_CriticalNesting++;
+}
+
+void EduRTOS_Port_EnableInterrupts(void){
+	EduRTOS_Port_CriticalNesting--;
+	if (0 != EduRTOS_Port_CriticalNesting){
+		return;
+	}
+	/*Do pending context switching, Task continues from here when it's switched in again.*/
+	if (EduRTOS_Port_ContextSwitchingPending){
+		EduRTOS_Port_SwitchTask();
+	}
+	EduRTOS_Port_InterruptsDisabled = 0;
+	sigprocmask(SIG_UNBLOCK, &EduRTOS_Port_TickSignalSet, EduRTOS_NULL);
+}
+
+Edu_u32 EduRTOS_Port_DisableInterruptsFromISR(void){
+	const Edu_u32 WereInterruptsDisabled = EduRTOS_Port_InterruptsDisabled;
+	sigprocmask(SIG_BLOCK, &EduRTOS_Port_TickSignalSet, EduRTOS_NULL);
+	EduRTOS_Port_InterruptsDisabled = 1;
+	return WereInterruptsDisabled;
+}
+
+void EduRTOS_Port_EnableInterruptsFromISR(const Edu_u32 WereInterruptsDisabled){
+	if (0 != WereInterruptsDisabled){
+		return;
+	}
+	/*Like PendSV at exit of interrupt, pending context switching is done once interrupted code can be preempted.*/
+	if (EduRTOS_Port_ContextSwitchingPending){
+		EduRTOS_Port_SwitchTask();
+	}
+	EduRTOS_Port_InterruptsDisabled = 0;
+	sigprocmask(SIG_UNBLOCK, &EduRTOS_Port_TickSignalSet, EduRTOS_NULL);
+}
+
+void EduRTOS_Port_RequestContextSwitching(void){
+	EduRTOS_Port_ContextSwitchingPending = 1;
+	/*Like PendSV, context switching is done right away if interrupts are enabled.*/
+	if (0 == EduRTOS_Port_InterruptsDisabled){
+		EduRTOS_Port_DisableInterrupts();
+		EduRTOS_Port_EnableInterrupts();
+	}
+}
+
+void EduRTOS_Port_Init(void){
+	sigemptyset(&EduRTOS_Port_TickSignalSet);
+	sigaddset(&EduRTOS_Port_TickSignalSet, SIGALRM);
+}
+
+Edu_uptr EduRTOS_Port_InitTaskStack(Edu_u8 * const StackTop, const Edu_u32 StackSize,
+		void (*TaskFunction) (), Edu_u32 const * const Parameters){
+
+	EduRTOS_Port_TaskContext * const TaskContext =
+			(EduRTOS_Port_TaskContext *)(((Edu_uptr)StackTop - sizeof(EduRTOS_Port_TaskContext)) & ~(Edu_uptr)15);
+	Edu_u8 * const StackBottom = StackTop - StackSize;
+
+	TaskContext->Function = TaskFunction;
+	for (Edu_u32 i = 0; i < 4; i++){
+		TaskContext->Parameters[i] = (EduRTOS_NULL != Parameters) ? Parameters[i] : 0;
+	}
+
+	getcontext(&TaskContext->Context);
+	/*Rest of stack (below context) is used by task.*/
+	TaskContext->Context.uc_stack.ss_sp = StackBottom;
+	TaskContext->Context.uc_stack.ss_size = (Edu_u8 *)TaskContext - StackBottom;
+	TaskContext->Context.uc_link = EduRTOS_NULL;
+	sigemptyset(&TaskContext->Context.uc_sigmask);
+	makecontext(&TaskContext->Context, EduRTOS_Port_TaskEntry, 0);
+
+	return (Edu_uptr)TaskContext;
+}
+
+void EduRTOS_Port_StartScheduler(void){
+	struct sigaction TickAction = {0};
+	TickAction.sa_handler = EduRTOS_Port_TickHandler;
+	/*System calls of tasks (like write) are restarted after tick signal.*/
+	TickAction.sa_flags = SA_RESTART;
+	sigemptyset(&TickAction.sa_mask);
+	sigaction(SIGALRM, &TickAction, EduRTOS_NULL);
+
+	struct itimerval TickTimer;
+	TickTimer.it_interval.tv_sec  = EduRTOS_Config_Systick_RATE_ms / 1000;
+	TickTimer.it_interval.tv_usec = (EduRTOS_Config_Systick_RATE_ms % 1000) * 1000;
+	TickTimer.it_value = TickTimer.it_interval;
+	setitimer(ITIMER_REAL, &TickTimer, EduRTOS_NULL);
+
+	/*Run first task, Context of main function is never restored.*/
+	EduRTOS_Port_InterruptsDisabled = 1;
+	setcontext(&EduRTOS_Port_TaskContextOf(EduRTOS_CurrentTCB)->Context);
+
+	EduRTOS_Port_Halt();
+}
+
+void EduRTOS_Port_Halt(void){
+	sigprocmask(SIG_BLOCK, &EduRTOS_Port_TickSignalSet, EduRTOS_NULL);
+	fprintf(stderr, "EduRTOS: Error handler is called\n");
+	abort();
+}
+
+#if EduRTOS_USE_PORT_TIMESTAMP
+Edu_u32 EduRTOS_Port_MonotonicTimestamp(void){
+	struct timespec Now;
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	/*Timestamp wraps around every 4.29 seconds.*/
+	return (Edu_u32)(((Edu_u64)Now.tv_sec * 1000000000ULL) + (Edu_u64)Now.tv_nsec);
+}
+#endif
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+Edu_u32 EduRTOS_Port_SuppressTicksAndSleep(const Edu_u32 ExpectedIdleTicks, Edu_u64 * const SleepCounts){
+	(void)ExpectedIdleTicks;
+	struct timespec SleepStartTime;
+	sigset_t WakeupSignalSet;
+
+	clock_gettime(CLOCK_MONOTONIC, &SleepStartTime);
+
+	/*Interval timer keeps running, so process sleeps till next tick signal (Like WFI) and its handler counts the tick.*/
+	sigprocmask(SIG_SETMASK, EduRTOS_NULL, &WakeupSignalSet);
+	sigdelset(&WakeupSignalSet, SIGALRM);
+	sigsuspend(&WakeupSignalSet);
+
+	/*Handler may switch to other tasks before sleep returns, so sleep ends at time of tick signal.*/
+	const Edu_s64 SleptNanoseconds =
+			((Edu_s64)(EduRTOS_Port_LastTickTime.tv_sec - SleepStartTime.tv_sec) * 1000000000LL) +
+			(EduRTOS_Port_LastTickTime.tv_nsec - SleepStartTime.tv_nsec);
+	if (SleptNanoseconds > 0){
+		*SleepCounts += (Edu_u64)SleptNanoseconds;
+	}
+	return 0;
+}
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * File Name --> port_posix.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Port macros to run EduRTOS as Linux (POSIX) process.
+ * */
+
+#ifndef EDUCATIONALRTOS_PORT_POSIX_H_
+#define EDUCATIONALRTOS_PORT_POSIX_H_
+
+/*
+==================================================
+  Start Section --> Configurations
+==================================================
+ */
+
+/*Minimum stack size of host task, as signal handlers and C library run on task stack.*/
+#define 	EduRTOS_Port_MIN_STACK_SIZE				(64*1024)
+
+/*Size of memory region of tasks stacks.*/
+#define 	EduRTOS_Port_STACK_REGION_SIZE			((EduRTOS_Config_MAX_NUMBER_OF_TASKS + 1) * EduRTOS_Port_MIN_STACK_SIZE)
+/*
+==================================================
+  End Section --> Configurations
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+/*Signals of tick timer are blocked while interrupts are disabled, Critical sections can be nested.*/
+void EduRTOS_Port_DisableInterrupts(void);
+void EduRTOS_Port_EnableInterrupts(void);
+/*Signal handlers (interrupts) save and restore previous state, pending context switching is done when it's restored to enabled.*/
+Edu_u32 EduRTOS_Port_DisableInterruptsFromISR(void);
+void EduRTOS_Port_EnableInterruptsFromISR(const Edu_u32 WereInterruptsDisabled);
+void EduRTOS_Port_RequestContextSwitching(void);
+/*Nanoseconds of monotonic clock, It's port timestamp.*/
+Edu_u32 EduRTOS_Port_MonotonicTimestamp(void);
+
+extern Edu_u8 EduRTOS_Port_StackRegion[EduRTOS_Port_STACK_REGION_SIZE];
+#if EduRTOS_Config_USE_HEAP
+extern Edu_u8 EduRTOS_Port_HeapRegion[EduRTOS_Config_HEAP_SIZE];
+#endif
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Port Macros
+==================================================
+ */
+#define 	EduRTOS_EnterCritical()					EduRTOS_Port_DisableInterrupts()
+#define 	EduRTOS_ExitCritical()					EduRTOS_Port_EnableInterrupts()
+#define 	EduRTOS_EnterCriticalFromISR()			EduRTOS_Port_DisableInterruptsFromISR()
+#define 	EduRTOS_ExitCriticalFromISR(SavedMask)	EduRTOS_Port_EnableInterruptsFromISR(SavedMask)
+
+#define 	EduRTOS_Port_ContextSwitchingTrigger()	EduRTOS_Port_RequestContextSwitching()
+
+#define 	EduRTOS_Port_CountLeadingZeros(Value)	((Edu_u32)__builtin_clz(Value))
+
+/*Stack pointer of x86-64 must be 16-byte aligned.*/
+#define 	EduRTOS_Port_StackSize(Size)			(((((Size) > EduRTOS_Port_MIN_STACK_SIZE) ? (Size) : EduRTOS_Port_MIN_STACK_SIZE) + 15UL) & ~15UL)
+
+/*Sleep time is measured in nanoseconds, and host sleeps till next tick signal so number of suppressed ticks isn't limited.*/
+#define 	EduRTOS_Port_TIMER_COUNTS_PER_TICK		(EduRTOS_Config_Systick_RATE_ms * 1000000UL)
+#define 	EduRTOS_Port_MAX_SUPPRESSED_TICKS		0x7FFFFFFFUL
+
+#define 	EduRTOS_TASKS_STACK_TOP					(&EduRTOS_Port_StackRegion[EduRTOS_Port_STACK_REGION_SIZE])
+#define 	EduRTOS_TASKS_STACK_REGION_SIZE			EduRTOS_Port_STACK_REGION_SIZE
+#define 	EduRTOS_HEAP_START						(&EduRTOS_Port_HeapRegion[0])
+#define 	EduRTOS_HEAP_SIZE						EduRTOS_Config_HEAP_SIZE
+#define 	EduRTOS_Port_Timestamp()				EduRTOS_Port_MonotonicTimestamp()
+#define 	EduRTOS_Port_TIMESTAMP_HZ				1000000000UL
+/*
+==================================================
+  End Section --> Port Macros
+==================================================
+ */
+
+#endif /* EDUCATIONALRTOS_PORT_POSIX_H_ */
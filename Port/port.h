@@ -0,0 +1,118 @@
+/*
+ * File Name --> port.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Port layer, It's the only part of EduRTOS that depends on target (processor / host),
+ * kernel uses hooks declared here and each port implements them.
+ * */
+
+#ifndef EDUCATIONALRTOS_PORT_H_
+#define EDUCATIONALRTOS_PORT_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+
+#if EduRTOS_Config_PORT == EduRTOS_PORT_ARM_CM4
+	#include "Port/ARM_CM4/port_cm4.h"
+#elif EduRTOS_Config_PORT == EduRTOS_PORT_POSIX
+	#include "Port/POSIX/port_posix.h"
+#else
+	#error "EduRTOS_Config_PORT is not supported"
+#endif
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+ * Each port header must define the following macros
+ * EduRTOS_EnterCritical()								--> Disable interrupts that call kernel (Tick & context switching), It can be nested.
+ * EduRTOS_ExitCritical()								--> Enable interrupts when the outermost critical section is left, pending context switching is done then.
+ * EduRTOS_EnterCriticalFromISR()						--> Disable interrupts that call kernel inside interrupt handler, It returns previous mask (Edu_u32).
+ * EduRTOS_ExitCriticalFromISR(SavedMask)				--> Restore mask of interrupts returned by EduRTOS_EnterCriticalFromISR.
+ * EduRTOS_Port_ContextSwitchingTrigger()				--> Request context switching, It's done once interrupts are enabled.
+ * EduRTOS_Port_CountLeadingZeros(Value)				--> Number of leading zeros of 32-bit value (Value isn't zero).
+ * EduRTOS_Port_StackSize(Size)							--> Stack size that is reserved for task that requests (Size) bytes.
+ * EduRTOS_Port_TIMER_COUNTS_PER_TICK					--> Number of tick timer counts in one tick.
+ * EduRTOS_Port_MAX_SUPPRESSED_TICKS					--> Maximum number of ticks that tick timer can sleep at once.
+ * EduRTOS_TASKS_STACK_TOP								--> Top address (Edu_u8 *) of memory region of tasks stacks.
+ * EduRTOS_TASKS_STACK_REGION_SIZE						--> Size of memory region of tasks stacks, It's multiple of stack alignment.
+ * EduRTOS_HEAP_START									--> Lowest address (Edu_u8 *) of memory region of heap (Heap only).
+ * EduRTOS_HEAP_SIZE									--> Size of memory region of heap (Heap only).
+ * EduRTOS_Port_Timestamp()							--> 32-bit high resolution timestamp, It may wrap around (Trace & runtime statistics only).
+ * EduRTOS_Port_TIMESTAMP_HZ							--> Number of timestamp counts in one second (Trace & runtime statistics only).
+ * */
+
+/*
+==================================================
+  Start Section --> Port APIs (Implemented by port)
+==================================================
+ */
+
+/* @brief  --> Initialize target, like priorities of tick and context switching interrupts.
+ * It's called by EduRTOS_Init with interrupts disabled.
+ * */
+void EduRTOS_Port_Init(void);
+
+/* @brief  --> Start tick timer and run current task (EduRTOS_CurrentTCB), It never returns.
+ * */
+void EduRTOS_Port_StartScheduler(void);
+
+/* @brief  				--> Initialize context of task on its stack, So it starts at its function when it's switched in first time.
+ * @param  StackTop 	--> Top address of task stack.
+ * @param  StackSize 	--> Size of task stack in bytes.
+ * @param  TaskFunction --> Function of task.
+ * @param  Parameters 	--> Four words that are passed to task function, or NULL to pass zeros.
+ * @retval --> Saved context of task, It's stored in pStackPointer of task TCB.
+ * */
+Edu_uptr EduRTOS_Port_InitTaskStack(Edu_u8 * const StackTop, const Edu_u32 StackSize,
+		void (*TaskFunction) (), Edu_u32 const * const Parameters);
+
+/* @brief  --> Stop target after fatal error, It never returns.
+ * */
+void EduRTOS_Port_Halt(void);
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+/* @brief  					 --> Stop periodic tick and sleep for number of ticks or till any interrupt, It's called inside critical section.
+ * @param  ExpectedIdleTicks --> Maximum number of ticks to sleep.
+ * @param  SleepCounts 		 --> Number of tick timer counts spent in sleep is added to it.
+ * @retval --> Number of complete ticks passed during sleep, that aren't counted by tick interrupt.
+ * */
+Edu_u32 EduRTOS_Port_SuppressTicksAndSleep(const Edu_u32 ExpectedIdleTicks, Edu_u64 * const SleepCounts);
+#endif
+/*
+==================================================
+  End Section --> Port APIs (Implemented by port)
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Kernel APIs (Called by port)
+==================================================
+ */
+
+/* @brief  --> Tick handler of kernel, It's called by tick interrupt of port.
+ * @retval --> Edu_True if context switching is required (Next task is already selected in EduRTOS_NextTCB).
+ * */
+Edu_Bool EduRTOS_TickIncrement(void);
+
+/*
+ * Kernel selects next task when it requests context switching, So context switching handler of port doesn't call kernel,
+ * It saves context of EduRTOS_CurrentTCB, copies EduRTOS_NextTCB to EduRTOS_CurrentTCB and restores its context.
+ * EduRTOS_NextTCB may be changed again before context is switched, Then handler switches to the last selected task.
+ * */
+/*
+==================================================
+  End Section --> Kernel APIs (Called by port)
+==================================================
+ */
+
+#endif /* EDUCATIONALRTOS_PORT_H_ */
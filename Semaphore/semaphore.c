@@ -6,6 +6,8 @@ EduRTOS_StdType_Status SemaphoreInit (Semaphore * const Arg_Semaphore_pSemaphore
 		return EduRTOS_StdType_Status_Fail;
 	}
 	Arg_Semaphore_pSemaphore->Semaphore_Value = Arg_Semaphore_InitVal;
+	/*No tasks wait semaphore*/
+	EduRTOS_ListInit(&Arg_Semaphore_pSemaphore->WaitingTasksList);
 	return EduRTOS_StdType_Status_Succeed;
 }
 
@@ -14,59 +16,40 @@ EduRTOS_StdType_Status SemaphoreTake (Semaphore * const Arg_Semaphore_pSemaphore
 	if (EduRTOS_NULL == Arg_Semaphore_pSemaphore){
 		return EduRTOS_StdType_Status_Fail;
 	}
-
-	/*If semaphore is already taken, block task till semaphore is available.*/
-	if(0 == __LDREXW( (Edu_u32 *) &Arg_Semaphore_pSemaphore->Semaphore_Value)){
-		EduRTOS_TaskBlock_Semaphore(Arg_Semaphore_pSemaphore);
-	}
-	/* Calculate Maximum number of ticks that can task wait, till it's unlocked.
+	/* If semaphore value is zero, task is blocked (without using CPU) till semaphore is given to it
+	 * or Arg_TicksToWait ticks are passed.
 	 * For example, assume current tick number is 50 and Arg_TicksToWait = 60,
-	 * So Mutex will fail to lock when system ticks = (60+50) = 120
+	 * So Semaphore will fail to be taken when system ticks = (60+50) = 110
 	 * */
-	const Edu_u32 WaitToTicks = Arg_TicksToWait + EduRTOS_GetCurrentTickNumber();
+	return EduRTOS_TaskTake_Semaphore(Arg_Semaphore_pSemaphore, Arg_TicksToWait);
+}
+
 
-	uint32_t Semaphore_temp_val;
-	while(1){
-		/*Check whether time to lock, exceed configured time or not.*/
-		if ((Arg_TicksToWait != EduRTOS_INFINITE) && (WaitToTicks > EduRTOS_GetCurrentTickNumber())){
-			return EduRTOS_StdType_Status_Timeout;
-		}
-		/*Exclusive load of semaphore value*/
-		Semaphore_temp_val = __LDREXW(&Arg_Semaphore_pSemaphore->Semaphore_Value);
-		if (Semaphore_temp_val > 0){
-			/*Exclusive store semaphore value*/
-			if (0 == __STREXW(Semaphore_temp_val - 1,&Arg_Semaphore_pSemaphore->Semaphore_Value)){
-				__DMB();
-				break;
-			}
-		}
+EduRTOS_StdType_Status SemaphoreGive(Semaphore * const Arg_Semaphore_pSemaphore, const Edu_u32 Arg_TicksToWait){
+	if (EduRTOS_NULL == Arg_Semaphore_pSemaphore){
+		return EduRTOS_StdType_Status_Fail;
 	}
+	/*Giving semaphore never blocks, so Arg_TicksToWait isn't used.*/
+	(void)Arg_TicksToWait;
+
+	/*Give semaphore to highest priority waiting task, or increase its value if no task waits it.*/
+	EduRTOS_TaskGive_Semaphore(Arg_Semaphore_pSemaphore);
 	return EduRTOS_StdType_Status_Succeed;
 }
 
 
-EduRTOS_StdType_Status SemaphoreGive(Semaphore * const Arg_Semaphore_pSemaphore, const Edu_u32 Arg_TicksToWait){
+EduRTOS_StdType_Status SemaphoreTakeFromISR(Semaphore * const Arg_Semaphore_pSemaphore){
 	if (EduRTOS_NULL == Arg_Semaphore_pSemaphore){
 		return EduRTOS_StdType_Status_Fail;
 	}
-	/* Calculate Maximum number of ticks that can task wait, till it's unlocked.
-	 * For example, assume current tick number is 50 and Arg_TicksToWait = 60,
-	 * So Mutex will fail to lock when system ticks = (60+50) = 120
-	 * */
-	const Edu_u32 WaitToTicks = Arg_TicksToWait + EduRTOS_GetCurrentTickNumber();
-	uint32_t Semaphore_temp_val;
-	while(1){
-		/*Check whether time to lock, exceed configured time or not.*/
-		if ((Arg_TicksToWait != EduRTOS_INFINITE) && (WaitToTicks > EduRTOS_GetCurrentTickNumber())){
-			return EduRTOS_StdType_Status_Timeout;
-		}
-		Semaphore_temp_val = __LDREXW(&Arg_Semaphore_pSemaphore->Semaphore_Value);
-		++Semaphore_temp_val;
+	return EduRTOS_TaskTake_SemaphoreFromISR(Arg_Semaphore_pSemaphore);
+}
 
-		if (0 == __STREXW(Semaphore_temp_val, &Arg_Semaphore_pSemaphore->Semaphore_Value)){
-			__DMB();
-			EduRTOS_TaskUnBlock_Semaphore(Arg_Semaphore_pSemaphore);
-			return EduRTOS_StdType_Status_Succeed;
-		}
+
+EduRTOS_StdType_Status SemaphoreGiveFromISR(Semaphore * const Arg_Semaphore_pSemaphore, Edu_Bool * const HigherPriorityTaskWoken){
+	if (EduRTOS_NULL == Arg_Semaphore_pSemaphore){
+		return EduRTOS_StdType_Status_Fail;
 	}
+	EduRTOS_TaskGive_SemaphoreFromISR(Arg_Semaphore_pSemaphore, HigherPriorityTaskWoken);
+	return EduRTOS_StdType_Status_Succeed;
 }
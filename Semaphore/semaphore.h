@@ -10,9 +10,12 @@
 #define SEMAPHORE_H_
 #include "EduRTOS_Config.h"
 #include "EduRTOS_defines.h"
+#include "List/list.h"
 
 typedef struct {
 	uint32_t Semaphore_Value;
+	/*Tasks blocked on this semaphore sorted by priority.*/
+	EduRTOS_List WaitingTasksList;
 }Semaphore;
 
 /* @brief  							--> Initialize Semaphore.
@@ -22,17 +25,30 @@ typedef struct {
  * */
 EduRTOS_StdType_Status SemaphoreInit (Semaphore * const Arg_Semaphore_pSemaphore, const uint32_t Arg_Semaphore_InitVal);
 
-/* @brief  							--> Take Semaphore.
+/* @brief  							--> Take Semaphore, If its value is zero task is blocked till it's given or timeout.
  * @param  Arg_Semaphore_pSemaphore --> Pointer of Semaphore.
- * @param  Arg_TicksToWait 			--> Timeout value for taking semaphore.
- * @retval --> Status if it's taken successfully or not.
+ * @param  Arg_TicksToWait 			--> Timeout value for taking semaphore (0 to return immediately, EduRTOS_INFINITE to wait forever).
+ * @retval --> EduRTOS_StdType_Status_Succeed if it's taken, EduRTOS_StdType_Status_Timeout if timeout is passed.
  * */
 EduRTOS_StdType_Status SemaphoreTake (Semaphore * const Arg_Semaphore_pSemaphore, const Edu_u32 Arg_TicksToWait);
 /* @brief  							--> Give Semaphore.
  * @param  Arg_Semaphore_pSemaphore --> Pointer of Semaphore.
- * @param  Arg_TicksToWait 			--> Timeout value for giving semaphore.
+ * @param  Arg_TicksToWait 			--> Not used, as giving semaphore never blocks.
  * @retval --> Status if it's given successfully or not.
  * */
 EduRTOS_StdType_Status SemaphoreGive(Semaphore * const Arg_Semaphore_pSemaphore, const Edu_u32 Arg_TicksToWait);
 
+/* @brief  							--> Take Semaphore from interrupt handler, It never blocks.
+ * @param  Arg_Semaphore_pSemaphore --> Pointer of Semaphore.
+ * @retval --> EduRTOS_StdType_Status_Succeed if it's taken, EduRTOS_StdType_Status_Timeout if its value is zero.
+ * */
+EduRTOS_StdType_Status SemaphoreTakeFromISR(Semaphore * const Arg_Semaphore_pSemaphore);
+
+/* @brief  							--> Give Semaphore from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_Semaphore_pSemaphore --> Pointer of Semaphore.
+ * @param  HigherPriorityTaskWoken 	--> Set to Edu_True if higher priority task is woken up, Pass it to EduRTOS_YieldFromISR at end of handler.
+ * @retval --> Status if it's given successfully or not.
+ * */
+EduRTOS_StdType_Status SemaphoreGiveFromISR(Semaphore * const Arg_Semaphore_pSemaphore, Edu_Bool * const HigherPriorityTaskWoken);
+
 #endif /* SEMAPHORE_H_ */
@@ -0,0 +1,146 @@
+/*
+ * File Name --> stack_allocator.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Coalescing free list allocator of tasks stacks.
+ * Note		 --> Free list is shared with running tasks that create or delete tasks, so caller must protect it by critical section.
+ * */
+
+#include "stack_allocator.h"
+#include "Port/port.h"
+
+#if EduRTOS_Config_TASK_STACKS_FROM_HEAP
+#include "Heap/heap.h"
+
+#if !EduRTOS_Config_USE_HEAP
+#error "EduRTOS_Config_TASK_STACKS_FROM_HEAP requires EduRTOS_Config_USE_HEAP"
+#endif
+
+/*Stacks share heap with application, Heap aligns blocks by EduRTOS_HEAP_ALIGNMENT which fits stack alignment of ports.*/
+Edu_u8 *EduRTOS_StackAllocate(Edu_u32 * const Size){
+	return (Edu_u8 *)EduRTOS_HeapAllocate(*Size);
+}
+
+void EduRTOS_StackFree(Edu_u8 * const StackBottom, const Edu_u32 Size){
+	(void)Size;
+	(void)EduRTOS_HeapFree(StackBottom);
+}
+
+Edu_u32 EduRTOS_StackGetFreeSize(void){
+	EduRTOS_HeapStats Stats;
+	(void)EduRTOS_HeapGetStats(&Stats);
+	return Stats.FreeSize;
+}
+
+Edu_u32 EduRTOS_StackGetLargestFreeBlock(void){
+	EduRTOS_HeapStats Stats;
+	(void)EduRTOS_HeapGetStats(&Stats);
+	return Stats.LargestFreeBlock;
+}
+
+#else
+
+/*
+ * Header of free block, It's stored at lowest address of block itself, So free list doesn't need memory.
+ * Allocated stacks don't have header, as TCB holds their address and size.
+ * */
+typedef struct EduRTOS_StackFreeBlock{
+	struct EduRTOS_StackFreeBlock *Next;
+	Edu_uptr Size;
+}EduRTOS_StackFreeBlock;
+
+/*Free blocks sorted by address, So adjacent blocks are merged by checking neighbours only.*/
+static EduRTOS_StackFreeBlock *EduRTOS_StackFreeList = EduRTOS_NULL;
+
+/*Whole region is one free block at first allocation.*/
+static Edu_Bool EduRTOS_StackIsInitialized = Edu_False;
+
+static void EduRTOS_StackInit(void){
+	EduRTOS_StackFreeList = (EduRTOS_StackFreeBlock *)(EduRTOS_TASKS_STACK_TOP - EduRTOS_TASKS_STACK_REGION_SIZE);
+	EduRTOS_StackFreeList->Next = EduRTOS_NULL;
+	EduRTOS_StackFreeList->Size = EduRTOS_TASKS_STACK_REGION_SIZE;
+	EduRTOS_StackIsInitialized = Edu_True;
+}
+
+Edu_u8 *EduRTOS_StackAllocate(Edu_u32 * const Size){
+	if (Edu_True != EduRTOS_StackIsInitialized){
+		EduRTOS_StackInit();
+	}
+
+	EduRTOS_StackFreeBlock **Link = &EduRTOS_StackFreeList;
+	while ((EduRTOS_NULL != *Link) && ((*Link)->Size < *Size)){
+		Link = &(*Link)->Next;
+	}
+	if (EduRTOS_NULL == *Link){
+		return EduRTOS_NULL;
+	}
+
+	EduRTOS_StackFreeBlock * const Block = *Link;
+	/*Rest of block can't hold header of free block, So whole block is given to stack.*/
+	if ((Block->Size - *Size) < sizeof(EduRTOS_StackFreeBlock)){
+		*Size = (Edu_u32)Block->Size;
+		*Link = Block->Next;
+		return (Edu_u8 *)Block;
+	}
+	/*Stack is cut from top of block, So header of block stays in its place.*/
+	Block->Size -= *Size;
+	return (Edu_u8 *)Block + Block->Size;
+}
+
+void EduRTOS_StackFree(Edu_u8 * const StackBottom, const Edu_u32 Size){
+	EduRTOS_StackFreeBlock * const Block = (EduRTOS_StackFreeBlock *)StackBottom;
+	EduRTOS_StackFreeBlock *Previous = EduRTOS_NULL;
+	EduRTOS_StackFreeBlock *Next = EduRTOS_StackFreeList;
+
+	/*Find free blocks before and after stack.*/
+	while ((EduRTOS_NULL != Next) && (Next < Block)){
+		Previous = Next;
+		Next = Next->Next;
+	}
+
+	Block->Size = Size;
+	Block->Next = Next;
+	/*Merge with next block if it starts at end of stack.*/
+	if ((EduRTOS_NULL != Next) && ((Edu_u8 *)Block + Block->Size == (Edu_u8 *)Next)){
+		Block->Size += Next->Size;
+		Block->Next = Next->Next;
+	}
+	/*Merge with previous block if it ends at bottom of stack.*/
+	if (EduRTOS_NULL == Previous){
+		EduRTOS_StackFreeList = Block;
+	}
+	else if ((Edu_u8 *)Previous + Previous->Size == (Edu_u8 *)Block){
+		Previous->Size += Block->Size;
+		Previous->Next = Block->Next;
+	}
+	else{
+		Previous->Next = Block;
+	}
+}
+
+Edu_u32 EduRTOS_StackGetFreeSize(void){
+	if (Edu_True != EduRTOS_StackIsInitialized){
+		return EduRTOS_TASKS_STACK_REGION_SIZE;
+	}
+	Edu_u32 FreeSize = 0;
+	for (EduRTOS_StackFreeBlock *Block = EduRTOS_StackFreeList; EduRTOS_NULL != Block; Block = Block->Next){
+		FreeSize += (Edu_u32)Block->Size;
+	}
+	return FreeSize;
+}
+
+Edu_u32 EduRTOS_StackGetLargestFreeBlock(void){
+	if (Edu_True != EduRTOS_StackIsInitialized){
+		return EduRTOS_TASKS_STACK_REGION_SIZE;
+	}
+	Edu_u32 LargestSize = 0;
+	for (EduRTOS_StackFreeBlock *Block = EduRTOS_StackFreeList; EduRTOS_NULL != Block; Block = Block->Next){
+		if (Block->Size > LargestSize){
+			LargestSize = (Edu_u32)Block->Size;
+		}
+	}
+	return LargestSize;
+}
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * File Name --> stack_allocator.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Allocator of tasks stacks from memory region of port (EduRTOS_TASKS_STACK_TOP), It's used by task.c.
+ * If EduRTOS_Config_TASK_STACKS_FROM_HEAP is 1, Stacks are allocated from heap instead.
+ * */
+
+#ifndef EDUCATIONALRTOS_STACK_ALLOCATOR_H_
+#define EDUCATIONALRTOS_STACK_ALLOCATOR_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  			--> Allocate stack from free blocks of region (first fit in address order), It must be called inside critical section.
+ * Stack is taken from top of free block, So stacks are placed from top of region downwards like a stack of stacks.
+ * @param  Size 	--> Size of stack in bytes (aligned by EduRTOS_Port_StackSize), It's enlarged if rest of block is too small to be free block.
+ * @retval --> Lowest address of stack, or NULL if there is no free block that fits it.
+ * */
+Edu_u8 *EduRTOS_StackAllocate(Edu_u32 * const Size);
+
+/* @brief  				--> Return stack to free blocks of region, It's merged with adjacent free blocks.
+ * It must be called inside critical section.
+ * @param  StackBottom 	--> Lowest address of stack returned by EduRTOS_StackAllocate.
+ * @param  Size 		--> Size of stack returned by EduRTOS_StackAllocate.
+ * */
+void EduRTOS_StackFree(Edu_u8 * const StackBottom, const Edu_u32 Size);
+
+/* @brief  --> Get total size of free blocks of region.
+ * @retval --> Number of free bytes.
+ * */
+Edu_u32 EduRTOS_StackGetFreeSize(void);
+
+/* @brief  --> Get size of the largest free block, It's the largest stack that can be allocated.
+ * @retval --> Number of bytes.
+ * */
+Edu_u32 EduRTOS_StackGetLargestFreeBlock(void);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+
+#endif /* EDUCATIONALRTOS_STACK_ALLOCATOR_H_ */
@@ -7,6 +7,9 @@
  * */
 
 #include "task.h"
+#include "Port/port.h"
+#include "Trace/trace.h"
+#include "stack_allocator.h"
 
 /*Holds tick number of system*/
 volatile static Edu_u32 EduRTOS_CurrentTickNumber = 0;
@@ -20,128 +23,958 @@ volatile static Edu_u32 EduRTOS_NumberOfCreatedTasks = 0;
 
 volatile static Edu_u32 EduRTOS_CurrentRunningTask = 0;
 
-volatile static Edu_u32 EduRTOS_NextTopTaskStackAddress = EduRTOS_TASKS_STACK_TOP;
+/*TCB whose context is on processor, It's written only by context switching handler of port (and at start of scheduler).*/
+EduRTOS_TCB * volatile EduRTOS_CurrentTCB = EduRTOS_NULL;
 
-#define EduRTOS_ContextSwitchingTrigger() (SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk)
+/*TCB of task selected by kernel (EduRTOS_CurrentRunningTask), Port switches to it once context switching is done.*/
+EduRTOS_TCB * volatile EduRTOS_NextTCB = EduRTOS_NULL;
 
+/*
+ * Tasks that deleted themselves, Their stacks are still used till context is switched to another task,
+ * So they are freed later by EduRTOS_FreeTerminatedStacks.
+ * */
+static EduRTOS_List EduRTOS_TerminatedTasksList;
 
-void EduRTOS_TaskBlock_Mutex(Mutex * const Arg_Mutex){
-	if (EduRTOS_NULL == Arg_Mutex){
-		EduRTOS_ErrorHandler();
+/*
+ * Tasks that wait tick time sorted by their wakeup tick, So tick handler only checks head of list.
+ * */
+static EduRTOS_List EduRTOS_DelayedTasksList;
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+/*Number of tick timer counts that processor spent in sleep.*/
+static Edu_u64 EduRTOS_SleepCounts = 0;
+#endif
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+/*Timestamp from which run time of current task is counted, It's updated at context switching and tick.*/
+static Edu_u32 EduRTOS_RunTimeStartTimestamp = 0;
+#endif
+
+/*
+ * Ready bitmap, bit (n) is set when ready list of priority (n) isn't empty.
+ * Bits are grouped in 32-bit words and bit (w) of EduRTOS_ReadyGroupBitmap is set when
+ * word (w) isn't empty, So any lookup costs two CLZ instructions whatever number of tasks is.
+ * Note idle task (priority 0) is never stored in bitmap, as it's always ready to run.
+ * Word of (EduRTOS_Config_MAX_PRIORITY + 1) is included, as it's upper limit of search.
+ * */
+#define EduRTOS_READY_BITMAP_WORDS			(((EduRTOS_Config_MAX_PRIORITY + 1)/32) + 1)
+
+#if EduRTOS_READY_BITMAP_WORDS > 32
+#error "EduRTOS_Config_MAX_PRIORITY must be less than 1023"
+#endif
+
+volatile static Edu_u32 EduRTOS_ReadyGroupBitmap = 0;
+volatile static Edu_u32 EduRTOS_ReadyBitmap[EduRTOS_READY_BITMAP_WORDS];
+
+/*
+ * Ready tasks of each priority in FIFO order, Running task isn't stored in them.
+ * So any task of the same priority is selected by taking head of its list.
+ * */
+static EduRTOS_List EduRTOS_ReadyLists[EduRTOS_Config_MAX_PRIORITY + 1];
+
+/*TCB list items are only accessed inside critical sections or interrupts, so volatile qualifier of TCBs array is dropped.*/
+#define EduRTOS_TCBListItem(TargetTaskId, Item)	((EduRTOS_ListItem *)&EduRTOS_TCBsArray[TargetTaskId].Item)
+#define EduRTOS_TCBListHead(TargetTaskId, List)	((EduRTOS_List *)&EduRTOS_TCBsArray[TargetTaskId].List)
+
+/*Functions used in context switching path are inlined.*/
+#define EduRTOS_FORCE_INLINE	static inline __attribute__((always_inline))
+
+EduRTOS_FORCE_INLINE void EduRTOS_ReadyBitmap_Set(const Edu_u32 Priority){
+	EduRTOS_ReadyBitmap[Priority >> 5] |= (1UL << (Priority & 31));
+	EduRTOS_ReadyGroupBitmap |= (1UL << (Priority >> 5));
+}
+
+EduRTOS_FORCE_INLINE void EduRTOS_ReadyBitmap_Clear(const Edu_u32 Priority){
+	EduRTOS_ReadyBitmap[Priority >> 5] &= ~(1UL << (Priority & 31));
+	if (0 == EduRTOS_ReadyBitmap[Priority >> 5]){
+		EduRTOS_ReadyGroupBitmap &= ~(1UL << (Priority >> 5));
 	}
-	__disable_irq();
-	TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
+}
+
+/* @brief  			--> Find highest priority of ready tasks that is lower than passed priority.
+ * @param  Priority --> Upper limit (excluded) of search.
+ * @retval --> Priority of found task, or 0 (Idle task priority) if there is no ready task.
+ * */
+EduRTOS_FORCE_INLINE Edu_u32 EduRTOS_ReadyBitmap_HighestBelow(const Edu_u32 Priority){
+	const Edu_u32 Word = Priority >> 5;
+	Edu_u32 Bits = EduRTOS_ReadyBitmap[Word] & ((1UL << (Priority & 31)) - 1);
+
+	if (0 != Bits){
+		return (Word << 5) + (31 - EduRTOS_Port_CountLeadingZeros(Bits));
+	}
+	/*Search in lower words*/
+	Bits = EduRTOS_ReadyGroupBitmap & ((1UL << Word) - 1);
+	if (0 != Bits){
+		const Edu_u32 LowerWord = 31 - EduRTOS_Port_CountLeadingZeros(Bits);
+		return (LowerWord << 5) + (31 - EduRTOS_Port_CountLeadingZeros(EduRTOS_ReadyBitmap[LowerWord]));
+	}
+	return 0;
+}
+
+/* @brief  				--> Insert task in ready list of its effective priority and set its bit in ready bitmap.
+ * @param  TargetTaskId --> Id of task.
+ * @param  AtHead 		--> Edu_True to insert task before other tasks of its priority, Edu_False to insert it after them.
+ * */
+EduRTOS_FORCE_INLINE void EduRTOS_ReadyListInsert(const TaskId TargetTaskId, const Edu_Bool AtHead){
+	EduRTOS_ListItem * const ReadyItem = EduRTOS_TCBListItem(TargetTaskId, ReadyListItem);
+	const Edu_u32 Priority = EduRTOS_TCBsArray[TargetTaskId].EffectivePriority;
+
+	/*Priority of list is stored in item, So task is removed from the same list even if its priority is changed.*/
+	ReadyItem->ItemValue = Priority;
+	if (Edu_True == AtHead){
+		EduRTOS_ListInsertHead(&EduRTOS_ReadyLists[Priority], ReadyItem);
+	}
+	else{
+		EduRTOS_ListInsertTail(&EduRTOS_ReadyLists[Priority], ReadyItem);
+	}
+	EduRTOS_ReadyBitmap_Set(Priority);
+}
+
+/* @brief  				--> Remove task from its ready list, Bit of its priority is cleared if it was the last ready task of it.
+ * @param  TargetTaskId --> Id of task.
+ * */
+EduRTOS_FORCE_INLINE void EduRTOS_ReadyListRemove(const TaskId TargetTaskId){
+	EduRTOS_ListItem * const ReadyItem = EduRTOS_TCBListItem(TargetTaskId, ReadyListItem);
+	const Edu_u32 Priority = ReadyItem->ItemValue;
+
+	EduRTOS_ListRemove(ReadyItem);
+	if (EduRTOS_ListIsEmpty(&EduRTOS_ReadyLists[Priority])){
+		EduRTOS_ReadyBitmap_Clear(Priority);
+	}
+}
+
+/* @brief  				--> Change task status and keep ready lists and ready bitmap up to date.
+ * Task that becomes ready is inserted at tail of ready list of its priority.
+ * @param  TargetTaskId --> Id of task.
+ * @param  NewStatus 	--> New status of task.
+ * */
+EduRTOS_FORCE_INLINE void EduRTOS_SetTaskStatus(const TaskId TargetTaskId, const EduTask_Status NewStatus){
+	const EduTask_Status OldStatus = EduRTOS_TCBsArray[TargetTaskId].TaskStatus;
+
+	EduRTOS_TCBsArray[TargetTaskId].TaskStatus = NewStatus;
+	if ((EduRTOS_IDLE_TASK == TargetTaskId) || (OldStatus == NewStatus)){
+		return;
+	}
+	if (EduRTOS_TaskStatus_Ready == OldStatus){
+		EduRTOS_ReadyListRemove(TargetTaskId);
+	}
+	if (EduRTOS_TaskStatus_Ready == NewStatus){
+		EduRTOS_ReadyListInsert(TargetTaskId, Edu_False);
+	}
+}
+
+/* @brief  --> Select next task to run, Priorities are visited in circular order which starts after priority of current task,
+ * So next task is head of ready list of the highest priority that is lower than priority of current task, and if there is no one,
+ * search wraps around to highest priority (It may be priority of current task if other tasks share it).
+ * In case of preemption (ready task has become higher than current task) the highest priority is selected directly.
+ * Current task isn't in ready lists so it's never selected, and if no task is ready idle task is selected.
+ * @param  IsPreemption --> Edu_True if context is switched because ready task has higher priority than current task.
+ * @retval --> Id of next task.
+ * */
+EduRTOS_FORCE_INLINE TaskId EduRTOS_GetNextTask(const Edu_Bool IsPreemption){
+	Edu_u32 NextPriority = 0;
+
+	/*Circular order is used only when current task blocks, yields or finishes its time slots.*/
+	if (Edu_True != IsPreemption){
+		NextPriority = EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].EffectivePriority);
+	}
+
+	if (0 == NextPriority){
+		/*Wrap around (or preemption)*/
+		NextPriority = EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_Config_MAX_PRIORITY + 1);
+	}
+
+	if (0 == NextPriority){
+		return EduRTOS_IDLE_TASK;
+	}
+	return ((EduRTOS_TCB *)EduRTOS_ListGetHead(&EduRTOS_ReadyLists[NextPriority])->Owner)->TaskIdentifier;
+}
+
+/* @brief  				--> Reload time slots of task from its time slice.
+ * @param  TargetTaskId --> Id of task.
+ * */
+EduRTOS_FORCE_INLINE void EduRTOS_UpdateTimeSlots(const TaskId TargetTaskId){
+	if (EduRTOS_TIME_SLICE_BY_PRIORITY == EduRTOS_TCBsArray[TargetTaskId].TimeSliceTicks){
+		EduRTOS_TCBsArray[TargetTaskId].TotalTimeSlots = EduRTOS_TCBsArray[TargetTaskId].EffectivePriority;
+	}
+	else{
+		/*Task runs for (TotalTimeSlots + 1) ticks.*/
+		EduRTOS_TCBsArray[TargetTaskId].TotalTimeSlots = EduRTOS_TCBsArray[TargetTaskId].TimeSliceTicks - 1;
+	}
+}
+
+
+/* @brief  				--> Insert current task in wait list of object sorted by priority (highest priority is head),
+ * and tasks that have same priority are kept in FIFO order.
+ * @param  TargetTaskId --> Id of task.
+ * @param  WaitingList 	--> Wait list of object (Mutex, Semaphore, ... etc).
+ * */
+static void EduRTOS_InsertInWaitingList(const TaskId TargetTaskId, EduRTOS_List * const WaitingList){
+	EduRTOS_ListItem * const EventItem = EduRTOS_TCBListItem(TargetTaskId, EventListItem);
+	/*List is sorted in ascending order, so store inverted priority.*/
+	EventItem->ItemValue = EduRTOS_Config_MAX_PRIORITY - EduRTOS_TCBsArray[TargetTaskId].EffectivePriority;
+	EduRTOS_ListInsertOrdered(WaitingList, EventItem);
+}
+
+/* @brief  				--> Recalculate effective priority of task from its base priority and mutexes that it holds.
+ * Task is moved to ready list of its new priority or reordered in wait list of object that it waits.
+ * Change of priority is propagated through chain of tasks, for example if task is blocked on
+ * mutex held by another task, priority of the other task is recalculated too.
+ * @param  TargetTaskId --> Id of task.
+ * */
+static void EduRTOS_UpdateEffectivePriority(TaskId TargetTaskId){
+	while (1){
+		Edu_u32 NewPriority = EduRTOS_TCBsArray[TargetTaskId].Priority;
+
+		/*Effective priority is the maximum of priorities inherited from each held mutex.*/
+		for (EduRTOS_ListItem *HeldItem = EduRTOS_ListGetHead(EduRTOS_TCBListHead(TargetTaskId, HeldMutexesList));
+				EduRTOS_NULL != HeldItem;
+				HeldItem = HeldItem->Next){
+
+			Mutex * const HeldMutex = (Mutex *)HeldItem->Owner;
+			Edu_u32 InheritedPriority = 0;
+
+			/*Highest priority waiting task is the head of wait list.*/
+			if (!EduRTOS_ListIsEmpty(&HeldMutex->WaitingTasksList)){
+				InheritedPriority = ((EduRTOS_TCB *)EduRTOS_ListGetHead(&HeldMutex->WaitingTasksList)->Owner)->EffectivePriority;
+			}
+			if ((EduRTOS_Mutex_Protocol_PriorityCeiling == HeldMutex->Protocol) && (HeldMutex->CeilingPriority > InheritedPriority)){
+				InheritedPriority = HeldMutex->CeilingPriority;
+			}
+			if (InheritedPriority > NewPriority){
+				NewPriority = InheritedPriority;
+			}
+		}
+
+		if (NewPriority == EduRTOS_TCBsArray[TargetTaskId].EffectivePriority){
+			return;
+		}
+		EduRTOS_TCBsArray[TargetTaskId].EffectivePriority = NewPriority;
+		/*Time slots of task follows its effective priority (if its time slice is by priority).*/
+		EduRTOS_UpdateTimeSlots(TargetTaskId);
+
+		/*Ready task is moved to tail of ready list of its new priority.*/
+		if (EduRTOS_TaskStatus_Ready == EduRTOS_TCBsArray[TargetTaskId].TaskStatus){
+			EduRTOS_ReadyListRemove(TargetTaskId);
+			EduRTOS_ReadyListInsert(TargetTaskId, Edu_False);
+		}
+
+		/*If task waits an object, reorder it in wait list of object.*/
+		EduRTOS_ListItem * const EventItem = EduRTOS_TCBListItem(TargetTaskId, EventListItem);
+		if (!EduRTOS_ListItemIsInserted(EventItem)){
+			return;
+		}
+		EduRTOS_List * const WaitingList = EventItem->Container;
+		EduRTOS_ListRemove(EventItem);
+		EduRTOS_InsertInWaitingList(TargetTaskId, WaitingList);
+
+		/*Holder of mutex that task waits, inherits its new priority.*/
+		if (EduTask_BlockingReason_MutexLocked != EduRTOS_TCBsArray[TargetTaskId].BlockingReason){
+			return;
+		}
+		TargetTaskId = EduRTOS_TCBsArray[TargetTaskId].BlockingMutex->TaskLockId;
+	}
+}
+
+/* @brief  				--> Check whether task has higher priority than current running task.
+ * @param  TargetTaskId --> Id of task.
+ * @retval --> Edu_True if context switching is required to run task.
+ * */
+static Edu_Bool EduRTOS_IsHigherThanCurrentTask(const TaskId TargetTaskId){
+	if (EduRTOS_TCBsArray[TargetTaskId].EffectivePriority > EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].EffectivePriority){
+		return Edu_True;
+	}
+	return Edu_False;
+}
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+/* @brief  --> Add time since last update to run time of current task, It must be called inside critical section.
+ * Difference of 32-bit timestamps is correct across wrap around, as it's updated at least every tick.
+ * */
+EduRTOS_FORCE_INLINE void EduRTOS_UpdateRunTime(void){
+	const Edu_u32 Now = EduRTOS_Port_Timestamp();
+	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].RunTimeCounts += (Edu_u32)(Now - EduRTOS_RunTimeStartTimestamp);
+	EduRTOS_RunTimeStartTimestamp = Now;
+}
+#endif
+
+/* @brief  --> Switch kernel state to next task, It must be called inside critical section (or tick interrupt)
+ * when context switching is required, so current task is never selected.
+ * Kernel state is switched here, and context switching handler of port only saves context of EduRTOS_CurrentTCB,
+ * copies EduRTOS_NextTCB to it and restores its context, so it doesn't run kernel code or disable interrupts.
+ * If it's called again before context is switched, the last selected task is switched in.
+ * @param  IsPreemption --> Edu_True if context is switched because ready task has higher priority than current task.
+ * */
+static void EduRTOS_SelectNextTask(const Edu_Bool IsPreemption){
+	/*Search for next task to run through ready bitmap (Idle task in case of no available task to run).*/
+	const TaskId NextTaskId = EduRTOS_GetNextTask(IsPreemption);
+	/*TCBs are only changed inside critical sections, so volatile qualifier is dropped.*/
+	EduRTOS_TCB * const NextTCB = (EduRTOS_TCB *)&EduRTOS_TCBsArray[NextTaskId];
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	/*Run time of switched out task is counted till now.*/
+	EduRTOS_UpdateRunTime();
+	NextTCB->SwitchInCount++;
+#endif
+
+	/*Preempted task is still ready, FIFO task keeps its place at head of its priority and round-robin task waits at tail.*/
+	if (EduRTOS_TaskStatus_Running == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus){
+		EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Ready;
+		if (EduRTOS_IDLE_TASK != EduRTOS_CurrentRunningTask){
+			EduRTOS_ReadyListInsert(EduRTOS_CurrentRunningTask,
+					(EduTask_SchedPolicy_FIFO == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].SchedPolicy) ? Edu_True : Edu_False);
+		}
+	}
+	EduRTOS_CurrentRunningTask = NextTaskId;
+	EduRTOS_SetTaskStatus(NextTaskId, EduRTOS_TaskStatus_Running);
+	EduRTOS_NextTCB = NextTCB;
+	EduRTOS_TRACE(EduRTOS_TraceEvent_Switch, NextTaskId, 0);
+}
+
+/* @brief  --> Select next task and request context switching, It must be called inside critical section,
+ * Context is switched once interrupts are enabled.
+ * */
+static void EduRTOS_ContextSwitchingTrigger(void){
+	EduRTOS_SelectNextTask(Edu_False);
+	EduRTOS_Port_ContextSwitchingTrigger();
+}
+
+/* @brief  --> Switch to the highest priority ready task and request context switching, It's called inside critical section
+ * when ready task becomes higher than current task, So it runs right away (not after lower priorities are visited).
+ * */
+static void EduRTOS_PreemptionTrigger(void){
+	EduRTOS_SelectNextTask(Edu_True);
+	EduRTOS_Port_ContextSwitchingTrigger();
+}
+
+/* @brief  				--> Block current task, It must be called inside critical section.
+ * Task is inserted in wait list of object (if any) and in delayed tasks list (if it's not waiting forever).
+ * @param  WaitingList 	--> Wait list of object (Mutex, Semaphore, ... etc), or NULL if task waits tick time only.
+ * @param  Reason 		--> Blocking reason.
+ * @param  TicksToWait 	--> Maximum number of ticks to wait, EduRTOS_INFINITE to wait forever.
+ * */
+static void EduRTOS_BlockCurrentTask(EduRTOS_List * const WaitingList, const EduTask_BlockingReason Reason, const Edu_u32 TicksToWait){
+	const TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
+
 	/*Switch task from running to blocked*/
-	EduRTOS_TCBsArray[TargetTaskId].TaskStatus = EduRTOS_TaskStatus_Blocked;
+	EduRTOS_SetTaskStatus(TargetTaskId, EduRTOS_TaskStatus_Blocked);
 	/*Assign blocking reason*/
-	EduRTOS_TCBsArray[TargetTaskId].BlockingReason = EduTask_BlockingReason_MutexLocked;
-	/*Pass mutex that blocks task.*/
-	EduRTOS_TCBsArray[TargetTaskId].BlockingMutex = Arg_Mutex;
-	__enable_irq();
+	EduRTOS_TCBsArray[TargetTaskId].BlockingReason = Reason;
+	/*Result if task isn't woken up by object before timeout.*/
+	EduRTOS_TCBsArray[TargetTaskId].WaitResult = EduRTOS_StdType_Status_Timeout;
+	EduRTOS_TRACE(EduRTOS_TraceEvent_Block, TargetTaskId, Reason);
+
+	if (EduRTOS_NULL != WaitingList){
+		EduRTOS_InsertInWaitingList(TargetTaskId, WaitingList);
+	}
+
+	if (EduRTOS_INFINITE != TicksToWait){
+		EduRTOS_TCBsArray[TargetTaskId].WaitingTillTick = EduRTOS_GetCurrentTickNumber() + TicksToWait;
+		/*Insert task in delayed tasks list sorted by its wakeup tick.*/
+		EduRTOS_TCBListItem(TargetTaskId, DelayedListItem)->ItemValue = EduRTOS_TCBsArray[TargetTaskId].WaitingTillTick;
+		EduRTOS_ListInsertOrdered(&EduRTOS_DelayedTasksList, EduRTOS_TCBListItem(TargetTaskId, DelayedListItem));
+	}
+}
+
+/* @brief  --> Leave critical section and switch to another task, It's called after EduRTOS_BlockCurrentTask.
+ * @retval --> Result of waiting (EduRTOS_StdType_Status_Succeed if it's woken up by object, or EduRTOS_StdType_Status_Timeout).
+ * */
+static EduRTOS_StdType_Status EduRTOS_WaitForWakeUp(void){
+	/*Context switching is done once interrupts are enabled.*/
 	EduRTOS_ContextSwitchingTrigger();
+	EduRTOS_ExitCritical();
+	/*Task continues from here after it's woken up.*/
+	return EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].WaitResult;
+}
+
+/* @brief  				--> Remove task from wait list of object and from delayed tasks list, It must be called inside critical section.
+ * @param  TargetTaskId --> Id of task.
+ * */
+static void EduRTOS_RemoveFromWaitLists(const TaskId TargetTaskId){
+	EduRTOS_ListItem * const EventItem = EduRTOS_TCBListItem(TargetTaskId, EventListItem);
+	EduRTOS_ListItem * const DelayedItem = EduRTOS_TCBListItem(TargetTaskId, DelayedListItem);
 
+	if (EduRTOS_ListItemIsInserted(EventItem)){
+		EduRTOS_ListRemove(EventItem);
+		/*Holder of mutex doesn't inherit priority of this task any more.*/
+		if (EduTask_BlockingReason_MutexLocked == EduRTOS_TCBsArray[TargetTaskId].BlockingReason){
+			EduRTOS_UpdateEffectivePriority(EduRTOS_TCBsArray[TargetTaskId].BlockingMutex->TaskLockId);
+		}
+	}
+	if (EduRTOS_ListItemIsInserted(DelayedItem)){
+		EduRTOS_ListRemove(DelayedItem);
+	}
 }
 
-void EduRTOS_TaskBlock_Semaphore(Semaphore * const Arg_Semaphore){
-	if (EduRTOS_NULL == Arg_Semaphore){
+/* @brief  				--> Move blocked task to ready state, It must be called inside critical section.
+ * Task is removed from wait list of object and from delayed tasks list.
+ * @param  TargetTaskId --> Id of task.
+ * @param  Result 		--> Result of waiting that is returned to task.
+ * */
+static void EduRTOS_WakeUpTask(const TaskId TargetTaskId, const EduRTOS_StdType_Status Result){
+	EduRTOS_RemoveFromWaitLists(TargetTaskId);
+	EduRTOS_TCBsArray[TargetTaskId].WaitResult = Result;
+	EduRTOS_SetTaskStatus(TargetTaskId, EduRTOS_TaskStatus_Ready);
+	EduRTOS_TRACE(EduRTOS_TraceEvent_Unblock, TargetTaskId, Result);
+}
+
+/* @brief  				--> Lock mutex by task, It must be called inside critical section.
+ * @param  Arg_Mutex 	--> Pointer of mutex.
+ * @param  TargetTaskId --> Id of task.
+ * */
+static void EduRTOS_MutexAcquire(Mutex * const Arg_Mutex, const TaskId TargetTaskId){
+	Arg_Mutex->Mutex_State = EduRTOS_Mutex_State_Locked;
+	/*Store task id that locked mutex.*/
+	Arg_Mutex->TaskLockId = TargetTaskId;
+	/*Add mutex to mutexes held by task, In case of priority ceiling task runs at ceiling priority.*/
+	EduRTOS_ListInsertTail(EduRTOS_TCBListHead(TargetTaskId, HeldMutexesList), &Arg_Mutex->HeldListItem);
+	EduRTOS_UpdateEffectivePriority(TargetTaskId);
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskLock_Mutex(Mutex * const Arg_Mutex, const Edu_u32 TicksToWait){
+	if (EduRTOS_NULL == Arg_Mutex){
 		EduRTOS_ErrorHandler();
 	}
-	__disable_irq();
+	EduRTOS_EnterCritical();
 	TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
-	/*Switch task from running to blocked*/
-	EduRTOS_TCBsArray[TargetTaskId].TaskStatus = EduRTOS_TaskStatus_Blocked;
-	/*Assign blocking reason*/
-	EduRTOS_TCBsArray[TargetTaskId].BlockingReason = EduTask_BlockingReason_SemaphoreLocked;
-	/*Pass semaphore that blocks task.*/
-	EduRTOS_TCBsArray[TargetTaskId].BlockingSemaphore = Arg_Semaphore;
-	__enable_irq();
-	EduRTOS_ContextSwitchingTrigger();
 
+	/*Task that has higher priority than ceiling priority, violates priority ceiling protocol.*/
+	if ((EduRTOS_Mutex_Protocol_PriorityCeiling == Arg_Mutex->Protocol) &&
+			(EduRTOS_TCBsArray[TargetTaskId].Priority > Arg_Mutex->CeilingPriority)){
+		EduRTOS_ErrorHandler();
+	}
+
+	if (EduRTOS_Mutex_State_Unlocked == Arg_Mutex->Mutex_State){
+		EduRTOS_MutexAcquire(Arg_Mutex, TargetTaskId);
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Succeed;
+	}
+
+	/*Mutex is locked, and task can't wait or it's already the holder (waiting will never end).*/
+	if ((0 == TicksToWait) || (TargetTaskId == Arg_Mutex->TaskLockId)){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Timeout;
+	}
+
+	/*Pass mutex that blocks task.*/
+	EduRTOS_TCBsArray[TargetTaskId].BlockingMutex = Arg_Mutex;
+	/*Wait in mutex's wait list, till holder hands mutex over to task or timeout.*/
+	EduRTOS_BlockCurrentTask(&Arg_Mutex->WaitingTasksList, EduTask_BlockingReason_MutexLocked, TicksToWait);
+	/*Holder of mutex inherits priority of blocked task, if it's higher.*/
+	EduRTOS_UpdateEffectivePriority(Arg_Mutex->TaskLockId);
+	return EduRTOS_WaitForWakeUp();
 }
 
-void EduRTOS_TaskUnBlock_Mutex(Mutex *Arg_Mutex){
+EduRTOS_StdType_Status EduRTOS_TaskUnLock_Mutex(Mutex * const Arg_Mutex){
 	if (EduRTOS_NULL == Arg_Mutex){
 		EduRTOS_ErrorHandler();
 	}
+	EduRTOS_EnterCritical();
+	/*It it was unlocked, no other operations needed.*/
+	if (EduRTOS_Mutex_State_Unlocked == Arg_Mutex->Mutex_State){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Succeed;
+	}
+	TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
 
-	Edu_Bool IsContextSwitchingRequired = Edu_False;
+	/*Task that locks Mutex, It's the only task that can release it*/
+	if (TargetTaskId != Arg_Mutex->TaskLockId){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Fail;
+	}
+	EduRTOS_ListRemove(&Arg_Mutex->HeldListItem);
 
-	/*Move tasks that hold this mutex from blocked state to ready state.*/
-	for (int i =0; i<EduRTOS_Config_MAX_NUMBER_OF_TASKS; i++){
-		/*If it's Idle task, continue.*/
-		if (EduRTOS_IDLE_TASK == i){
-			continue;
-		}
-		/*If it's not-valid task, continue.*/
-		if (Edu_False == EduRTOS_TCBsArray[i].ValidTask){
-			continue;
-		}
-		/*If it's not blocked, continue*/
-		if (EduRTOS_TaskStatus_Blocked != EduRTOS_TCBsArray[i].TaskStatus){
-			continue;
-		}
-		/*If it's reason of blocking is not due to mutex, continue*/
-		if (EduTask_BlockingReason_MutexLocked != EduRTOS_TCBsArray[i].BlockingReason){
-			continue;
-		}
-		/*If passed mutex not the same mutex that block task, continue*/
-		if (Arg_Mutex != EduRTOS_TCBsArray[i].BlockingMutex){
-			continue;
-		}
+	if (EduRTOS_ListIsEmpty(&Arg_Mutex->WaitingTasksList)){
+		Arg_Mutex->Mutex_State = EduRTOS_Mutex_State_Unlocked;
+		/*Restore priority of task from the rest of mutexes that it holds (nested mutexes).*/
+		EduRTOS_UpdateEffectivePriority(TargetTaskId);
+	}
+	else{
+		/*Hand mutex over to highest priority waiting task, so no other task can lock it before.
+		 * Priority of current task is restored once waiting task is removed from wait list.*/
+		const TaskId WakeupTaskId = ((EduRTOS_TCB *)EduRTOS_ListGetHead(&Arg_Mutex->WaitingTasksList)->Owner)->TaskIdentifier;
+		EduRTOS_WakeUpTask(WakeupTaskId, EduRTOS_StdType_Status_Succeed);
+		EduRTOS_MutexAcquire(Arg_Mutex, WakeupTaskId);
+	}
+	/*Woken task or any ready task that is higher than restored priority of current task, preempts it.*/
+	if (EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_Config_MAX_PRIORITY + 1) > EduRTOS_TCBsArray[TargetTaskId].EffectivePriority){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
 
-		if (EduRTOS_Mutex_State_Unlocked == GetMutexStatus(Arg_Mutex)){
-			EduRTOS_TCBsArray[i].TaskStatus = EduRTOS_TaskStatus_Ready;
-			if (EduRTOS_TCBsArray[i].Priority > EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].Priority){
-				IsContextSwitchingRequired = Edu_True;
-			}
-			break;
+EduRTOS_StdType_Status EduRTOS_TaskTake_Semaphore(Semaphore * const Arg_Semaphore, const Edu_u32 TicksToWait){
+	if (EduRTOS_NULL == Arg_Semaphore){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	if (0 != Arg_Semaphore->Semaphore_Value){
+		Arg_Semaphore->Semaphore_Value--;
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Succeed;
+	}
+
+	if (0 == TicksToWait){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Timeout;
+	}
+
+	/*Pass semaphore that blocks task.*/
+	EduRTOS_TCBsArray[EduRTOS_GetCurrentRunningTask()].BlockingSemaphore = Arg_Semaphore;
+	/*Wait in semaphore's wait list, till semaphore is given to task or timeout.*/
+	EduRTOS_BlockCurrentTask(&Arg_Semaphore->WaitingTasksList, EduTask_BlockingReason_SemaphoreLocked, TicksToWait);
+	return EduRTOS_WaitForWakeUp();
+}
+
+void EduRTOS_TaskGive_Semaphore(Semaphore * const Arg_Semaphore){
+	if (EduRTOS_NULL == Arg_Semaphore){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	if (EduRTOS_ListIsEmpty(&Arg_Semaphore->WaitingTasksList)){
+		Arg_Semaphore->Semaphore_Value++;
+	}
+	else{
+		/*Give semaphore directly to highest priority waiting task, so semaphore value is unchanged.*/
+		const TaskId WakeupTaskId = ((EduRTOS_TCB *)EduRTOS_ListGetHead(&Arg_Semaphore->WaitingTasksList)->Owner)->TaskIdentifier;
+		EduRTOS_WakeUpTask(WakeupTaskId, EduRTOS_StdType_Status_Succeed);
+		if (Edu_True == EduRTOS_IsHigherThanCurrentTask(WakeupTaskId)){
+			EduRTOS_PreemptionTrigger();
 		}
+	}
+	EduRTOS_ExitCritical();
+}
 
+EduRTOS_StdType_Status EduRTOS_TaskTake_SemaphoreFromISR(Semaphore * const Arg_Semaphore){
+	if (EduRTOS_NULL == Arg_Semaphore){
+		EduRTOS_ErrorHandler();
 	}
+	EduRTOS_StdType_Status Status = EduRTOS_StdType_Status_Timeout;
 
-	if (Edu_True == IsContextSwitchingRequired){
-		EduRTOS_ContextSwitchingTrigger();
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	if (0 != Arg_Semaphore->Semaphore_Value){
+		Arg_Semaphore->Semaphore_Value--;
+		Status = EduRTOS_StdType_Status_Succeed;
 	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	return Status;
 }
 
-void EduRTOS_TaskUnBlock_Semaphore(Semaphore *Arg_Semaphore){
+void EduRTOS_TaskGive_SemaphoreFromISR(Semaphore * const Arg_Semaphore, Edu_Bool * const HigherPriorityTaskWoken){
 	if (EduRTOS_NULL == Arg_Semaphore){
 		EduRTOS_ErrorHandler();
 	}
-	Edu_Bool IsContextSwitchingRequired = Edu_False;
-	/*Find which function*/
-	for (int i =0; i<EduRTOS_Config_MAX_NUMBER_OF_TASKS; i++){
-		/*Idle task*/
-		if (EduRTOS_Config_MAX_NUMBER_OF_TASKS == i){
-			continue;
-		}
 
-		if (!EduRTOS_TCBsArray[i].ValidTask){
-			continue;
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	if (EduRTOS_ListIsEmpty(&Arg_Semaphore->WaitingTasksList)){
+		Arg_Semaphore->Semaphore_Value++;
+	}
+	else{
+		const TaskId WakeupTaskId = ((EduRTOS_TCB *)EduRTOS_ListGetHead(&Arg_Semaphore->WaitingTasksList)->Owner)->TaskIdentifier;
+		EduRTOS_WakeUpTask(WakeupTaskId, EduRTOS_StdType_Status_Succeed);
+		/*Context switching is deferred to EduRTOS_YieldFromISR, So it's requested once at end of interrupt.*/
+		if ((EduRTOS_NULL != HigherPriorityTaskWoken) && (Edu_True == EduRTOS_IsHigherThanCurrentTask(WakeupTaskId))){
+			*HigherPriorityTaskWoken = Edu_True;
 		}
-		if (EduRTOS_TaskStatus_Blocked != EduRTOS_TCBsArray[i].TaskStatus){
-			continue;
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+}
+
+void EduRTOS_YieldFromISR(const Edu_Bool HigherPriorityTaskWoken){
+	if (Edu_True != HigherPriorityTaskWoken){
+		return;
+	}
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	/*Flag may be stale (woken task already runs after yield of nested interrupt, or it's blocked again),
+	 * So current task is preempted only by higher ready task, PendSV runs after all interrupts return (It has the lowest priority).*/
+	if (EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_Config_MAX_PRIORITY + 1) > EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].EffectivePriority){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+}
+
+#if EduRTOS_Config_USE_EVENT_GROUP
+/* @brief  			--> Check whether events meet wait condition.
+ * @param  Events 	--> Events of event group.
+ * @param  Waited 	--> Waited events.
+ * @param  WaitAll 	--> Edu_True if all waited events are required.
+ * @retval --> Edu_True if condition is met.
+ * */
+EduRTOS_FORCE_INLINE Edu_Bool EduRTOS_EventGroupIsConditionMet(const Edu_u32 Events, const Edu_u32 Waited, const Edu_Bool WaitAll){
+	if (Edu_True == WaitAll){
+		return ((Events & Waited) == Waited) ? Edu_True : Edu_False;
+	}
+	return (0 != (Events & Waited)) ? Edu_True : Edu_False;
+}
+
+/* @brief  					--> Set events and wake up waiting tasks that their condition is met, It must be called inside critical section.
+ * Every waiting task is checked against the same events, then events of woken tasks that clear them on exit are cleared,
+ * So tasks that wait the same event are all woken up whatever their order in wait list is.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Events 			--> Bits of events that are set.
+ * @param  IsHigherTaskWoken --> Set to Edu_True if any woken task has higher priority than current task.
+ * @retval --> Events after clearing events of woken tasks.
+ * */
+static Edu_u32 EduRTOS_EventGroupSetEvents(EventGroup * const Arg_EventGroup, const Edu_u32 Events, Edu_Bool * const IsHigherTaskWoken){
+	Edu_u32 EventsToClear = 0;
+
+	Arg_EventGroup->Events |= Events;
+	EduRTOS_ListItem *WaitingItem = EduRTOS_ListGetHead(&Arg_EventGroup->WaitingTasksList);
+	while (EduRTOS_NULL != WaitingItem){
+		/*Item is removed from wait list once task is woken up.*/
+		EduRTOS_ListItem * const NextItem = WaitingItem->Next;
+		EduRTOS_TCB * const WaitingTCB = (EduRTOS_TCB *)WaitingItem->Owner;
+
+		if (Edu_True == EduRTOS_EventGroupIsConditionMet(Arg_EventGroup->Events, WaitingTCB->WaitedEvents, WaitingTCB->WaitAllEvents)){
+			WaitingTCB->ReceivedEvents = Arg_EventGroup->Events;
+			if (Edu_True == WaitingTCB->ClearEventsOnExit){
+				EventsToClear |= WaitingTCB->WaitedEvents;
+			}
+			EduRTOS_WakeUpTask(WaitingTCB->TaskIdentifier, EduRTOS_StdType_Status_Succeed);
+			if (Edu_True == EduRTOS_IsHigherThanCurrentTask(WaitingTCB->TaskIdentifier)){
+				*IsHigherTaskWoken = Edu_True;
+			}
 		}
-		if (EduTask_BlockingReason_SemaphoreLocked != EduRTOS_TCBsArray[i].BlockingReason){
-			continue;
+		WaitingItem = NextItem;
+	}
+	Arg_EventGroup->Events &= ~EventsToClear;
+	return Arg_EventGroup->Events;
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskWait_EventGroup(EventGroup * const Arg_EventGroup, const Edu_u32 Events, const Edu_Bool WaitAll,
+		const Edu_Bool ClearOnExit, Edu_u32 * const ReceivedEvents, const Edu_u32 TicksToWait){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_StdType_Status Status = EduRTOS_StdType_Status_Timeout;
+
+	EduRTOS_EnterCritical();
+	const TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
+	if ((Edu_True != EduRTOS_EventGroupIsConditionMet(Arg_EventGroup->Events, Events, WaitAll)) && (0 != TicksToWait)){
+		/*Pass wait condition, It's checked by tasks that set events.*/
+		EduRTOS_TCBsArray[TargetTaskId].WaitedEvents = Events;
+		EduRTOS_TCBsArray[TargetTaskId].WaitAllEvents = WaitAll;
+		EduRTOS_TCBsArray[TargetTaskId].ClearEventsOnExit = ClearOnExit;
+		EduRTOS_BlockCurrentTask(&Arg_EventGroup->WaitingTasksList, EduTask_BlockingReason_WaitingEvents, TicksToWait);
+		Status = EduRTOS_WaitForWakeUp();
+		EduRTOS_EnterCritical();
+		/*Events are already cleared by task that set them.*/
+		if (EduRTOS_StdType_Status_Succeed == Status){
+			if (EduRTOS_NULL != ReceivedEvents){
+				*ReceivedEvents = EduRTOS_TCBsArray[TargetTaskId].ReceivedEvents;
+			}
+			EduRTOS_ExitCritical();
+			return Status;
 		}
-		if (Arg_Semaphore != EduRTOS_TCBsArray[i].BlockingSemaphore){
-			continue;
+	}
+
+	/*Condition is checked again after timeout, as events may be set after tick wakes task up and before it runs.*/
+	if (EduRTOS_NULL != ReceivedEvents){
+		*ReceivedEvents = Arg_EventGroup->Events;
+	}
+	if (Edu_True == EduRTOS_EventGroupIsConditionMet(Arg_EventGroup->Events, Events, WaitAll)){
+		if (Edu_True == ClearOnExit){
+			Arg_EventGroup->Events &= ~Events;
 		}
+		Status = EduRTOS_StdType_Status_Succeed;
+	}
+	EduRTOS_ExitCritical();
+	return Status;
+}
+
+Edu_u32 EduRTOS_TaskSet_EventGroup(EventGroup * const Arg_EventGroup, const Edu_u32 Events){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		EduRTOS_ErrorHandler();
+	}
+	Edu_Bool IsHigherTaskWoken = Edu_False;
+
+	EduRTOS_EnterCritical();
+	const Edu_u32 RemainingEvents = EduRTOS_EventGroupSetEvents(Arg_EventGroup, Events, &IsHigherTaskWoken);
+	/*Context is switched once, however many tasks are woken up.*/
+	if (Edu_True == IsHigherTaskWoken){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCritical();
+	return RemainingEvents;
+}
 
-		EduRTOS_TCBsArray[i].TaskStatus = EduRTOS_TaskStatus_Ready;
-		if (EduRTOS_TCBsArray[i].Priority > EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].Priority){
-			IsContextSwitchingRequired = 1;
+Edu_u32 EduRTOS_TaskSet_EventGroupFromISR(EventGroup * const Arg_EventGroup, const Edu_u32 Events, Edu_Bool * const HigherPriorityTaskWoken){
+	if (EduRTOS_NULL == Arg_EventGroup){
+		EduRTOS_ErrorHandler();
+	}
+	Edu_Bool IsHigherTaskWoken = Edu_False;
+
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	const Edu_u32 RemainingEvents = EduRTOS_EventGroupSetEvents(Arg_EventGroup, Events, &IsHigherTaskWoken);
+	/*Context switching is deferred to EduRTOS_YieldFromISR.*/
+	if ((EduRTOS_NULL != HigherPriorityTaskWoken) && (Edu_True == IsHigherTaskWoken)){
+		*HigherPriorityTaskWoken = Edu_True;
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	return RemainingEvents;
+}
+#endif
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+/* @brief  					--> Get mask of block in its word of used blocks bitmap of pool.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Block 			--> Address of block of pool.
+ * @param  Word 			--> Index of word of block in UsedBlocksBitmap.
+ * @retval --> Mask of bit of block.
+ * */
+EduRTOS_FORCE_INLINE Edu_u32 EduRTOS_MemoryPoolBlockBit(const MemoryPool * const Arg_MemoryPool, const void * const Block, Edu_u32 * const Word){
+	const Edu_u32 Index = (Edu_u32)((Edu_uptr)((const Edu_u8 *)Block - Arg_MemoryPool->Buffer) / Arg_MemoryPool->BlockSize);
+	*Word = Index >> 5;
+	return 1UL << (Index & 31);
+}
+
+/* @brief  					--> Take block from head of free list of pool, It must be called inside critical section.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @retval --> Address of block, or NULL if pool is empty.
+ * */
+static void *EduRTOS_MemoryPoolTake(MemoryPool * const Arg_MemoryPool){
+	void * const Block = Arg_MemoryPool->FreeList;
+
+	if (EduRTOS_NULL == Block){
+		Arg_MemoryPool->FailedAllocations++;
+		return EduRTOS_NULL;
+	}
+	/*First word of free block holds address of next free block.*/
+	Arg_MemoryPool->FreeList = *(void **)Block;
+	Edu_u32 Word;
+	const Edu_u32 Bit = EduRTOS_MemoryPoolBlockBit(Arg_MemoryPool, Block, &Word);
+	Arg_MemoryPool->UsedBlocksBitmap[Word] |= Bit;
+	Arg_MemoryPool->UsedBlocks++;
+	if (Arg_MemoryPool->UsedBlocks > Arg_MemoryPool->PeakUsedBlocks){
+		Arg_MemoryPool->PeakUsedBlocks = Arg_MemoryPool->UsedBlocks;
+	}
+	return Block;
+}
+
+/* @brief  					--> Give block to highest priority waiting task, or push it at head of free list if no task waits pool.
+ * It must be called inside critical section.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Block 			--> Address of block.
+ * @param  IsHigherTaskWoken --> Set to Edu_True if woken task has higher priority than current task.
+ * @retval --> EduRTOS_StdType_Status_Fail if block is already free.
+ * */
+static EduRTOS_StdType_Status EduRTOS_MemoryPoolGive(MemoryPool * const Arg_MemoryPool, void * const Block, Edu_Bool * const IsHigherTaskWoken){
+	Edu_u32 Word;
+	const Edu_u32 Bit = EduRTOS_MemoryPoolBlockBit(Arg_MemoryPool, Block, &Word);
+
+	/*Free block would be linked twice in free list, and then allocated twice.*/
+	if (0 == (Arg_MemoryPool->UsedBlocksBitmap[Word] & Bit)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	if (EduRTOS_ListIsEmpty(&Arg_MemoryPool->WaitingTasksList)){
+		*(void **)Block = Arg_MemoryPool->FreeList;
+		Arg_MemoryPool->FreeList = Block;
+		Arg_MemoryPool->UsedBlocksBitmap[Word] &= ~Bit;
+		Arg_MemoryPool->UsedBlocks--;
+		return EduRTOS_StdType_Status_Succeed;
+	}
+	/*Block stays used, It's handed over to waiting task, so no other task can take it before.*/
+	const TaskId WakeupTaskId = ((EduRTOS_TCB *)EduRTOS_ListGetHead(&Arg_MemoryPool->WaitingTasksList)->Owner)->TaskIdentifier;
+	EduRTOS_TCBsArray[WakeupTaskId].ReceivedMemoryBlock = Block;
+	EduRTOS_WakeUpTask(WakeupTaskId, EduRTOS_StdType_Status_Succeed);
+	*IsHigherTaskWoken = EduRTOS_IsHigherThanCurrentTask(WakeupTaskId);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+void *EduRTOS_TaskAllocate_MemoryPool(MemoryPool * const Arg_MemoryPool, const Edu_u32 TicksToWait){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	/*Pool isn't empty or task doesn't wait.*/
+	if ((EduRTOS_NULL != Arg_MemoryPool->FreeList) || (0 == TicksToWait)){
+		void * const Block = EduRTOS_MemoryPoolTake(Arg_MemoryPool);
+		EduRTOS_ExitCritical();
+		return Block;
+	}
+
+	/*Wait in pool's wait list, till block is freed and given to task or timeout.*/
+	EduRTOS_BlockCurrentTask(&Arg_MemoryPool->WaitingTasksList, EduTask_BlockingReason_WaitingMemoryBlock, TicksToWait);
+	if (EduRTOS_StdType_Status_Succeed == EduRTOS_WaitForWakeUp()){
+		return EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].ReceivedMemoryBlock;
+	}
+
+	/*Pool is checked again after timeout, as block may be freed after tick wakes task up and before it runs.*/
+	EduRTOS_EnterCritical();
+	void * const Block = EduRTOS_MemoryPoolTake(Arg_MemoryPool);
+	EduRTOS_ExitCritical();
+	return Block;
+}
+
+void *EduRTOS_TaskAllocate_MemoryPoolFromISR(MemoryPool * const Arg_MemoryPool){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		EduRTOS_ErrorHandler();
+	}
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	void * const Block = EduRTOS_MemoryPoolTake(Arg_MemoryPool);
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	return Block;
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskFree_MemoryPool(MemoryPool * const Arg_MemoryPool, void * const Block){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		EduRTOS_ErrorHandler();
+	}
+	Edu_Bool IsHigherTaskWoken = Edu_False;
+
+	EduRTOS_EnterCritical();
+	const EduRTOS_StdType_Status Status = EduRTOS_MemoryPoolGive(Arg_MemoryPool, Block, &IsHigherTaskWoken);
+	if (Edu_True == IsHigherTaskWoken){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCritical();
+	return Status;
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskFree_MemoryPoolFromISR(MemoryPool * const Arg_MemoryPool, void * const Block, Edu_Bool * const HigherPriorityTaskWoken){
+	if (EduRTOS_NULL == Arg_MemoryPool){
+		EduRTOS_ErrorHandler();
+	}
+	Edu_Bool IsHigherTaskWoken = Edu_False;
+
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	const EduRTOS_StdType_Status Status = EduRTOS_MemoryPoolGive(Arg_MemoryPool, Block, &IsHigherTaskWoken);
+	/*Context switching is deferred to EduRTOS_YieldFromISR.*/
+	if ((Edu_True == IsHigherTaskWoken) && (EduRTOS_NULL != HigherPriorityTaskWoken)){
+		*HigherPriorityTaskWoken = Edu_True;
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	return Status;
+}
+#endif
+
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+/* @brief  				--> Update notification value of task and wake it up if it waits notification,
+ * It must be called inside critical section. Only TCB of target task is changed, So it costs the same whatever number of tasks is.
+ * @param  TargetTaskId --> Id of task.
+ * @param  Value 		--> Value that is used by action.
+ * @param  Action 		--> Update of notification value.
+ * @param  IsWokenUp 	--> Set to Edu_True if task is woken up.
+ * @retval --> EduRTOS_StdType_Status_Fail if value isn't written (EduTask_Notify_SetValue), Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+static EduRTOS_StdType_Status EduRTOS_NotificationUpdate(const TaskId TargetTaskId, const Edu_u32 Value,
+		const EduTask_NotifyAction Action, Edu_Bool * const IsWokenUp){
+	*IsWokenUp = Edu_False;
+
+	switch (Action){
+	case EduTask_Notify_SetBits:
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue |= Value;
+		break;
+	case EduTask_Notify_Increment:
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue++;
+		break;
+	case EduTask_Notify_Overwrite:
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue = Value;
+		break;
+	case EduTask_Notify_SetValue:
+		/*Previous value isn't received yet, so it isn't lost.*/
+		if (Edu_True == EduRTOS_TCBsArray[TargetTaskId].NotificationPending){
+			return EduRTOS_StdType_Status_Fail;
 		}
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue = Value;
+		break;
+	default:
 		break;
+	}
+	EduRTOS_TCBsArray[TargetTaskId].NotificationPending = Edu_True;
+
+	if ((EduRTOS_TaskStatus_Blocked == EduRTOS_TCBsArray[TargetTaskId].TaskStatus) &&
+			(EduTask_BlockingReason_WaitingNotification == EduRTOS_TCBsArray[TargetTaskId].BlockingReason)){
+		EduRTOS_WakeUpTask(TargetTaskId, EduRTOS_StdType_Status_Succeed);
+		*IsWokenUp = Edu_True;
+	}
+	return EduRTOS_StdType_Status_Succeed;
+}
 
+/* @brief  			 --> Block current task till it's notified or timeout, It must be called inside critical section
+ * and critical section is entered again once task is woken up.
+ * @param  TicksToWait --> Maximum number of ticks to wait.
+ * */
+static void EduRTOS_WaitForNotification(const Edu_u32 TicksToWait){
+	EduRTOS_BlockCurrentTask(EduRTOS_NULL, EduTask_BlockingReason_WaitingNotification, TicksToWait);
+	/*Pending flag is checked instead of wait result, as task may be notified after timeout and before it runs.*/
+	(void)EduRTOS_WaitForWakeUp();
+	EduRTOS_EnterCritical();
+}
 
+EduRTOS_StdType_Status EduRTOS_TaskNotify(const TaskId TargetTaskId, const Edu_u32 Value, const EduTask_NotifyAction Action){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
 	}
+	Edu_Bool IsWokenUp;
 
-	if (Edu_True == IsContextSwitchingRequired){
-		EduRTOS_ContextSwitchingTrigger();
+	EduRTOS_EnterCritical();
+	const EduRTOS_StdType_Status Status = EduRTOS_NotificationUpdate(TargetTaskId, Value, Action, &IsWokenUp);
+	if ((Edu_True == IsWokenUp) && (Edu_True == EduRTOS_IsHigherThanCurrentTask(TargetTaskId))){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCritical();
+	return Status;
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskNotifyFromISR(const TaskId TargetTaskId, const Edu_u32 Value, const EduTask_NotifyAction Action,
+		Edu_Bool * const HigherPriorityTaskWoken){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
+	}
+	Edu_Bool IsWokenUp;
+
+	const Edu_u32 SavedMask = EduRTOS_EnterCriticalFromISR();
+	const EduRTOS_StdType_Status Status = EduRTOS_NotificationUpdate(TargetTaskId, Value, Action, &IsWokenUp);
+	/*Context switching is deferred to EduRTOS_YieldFromISR.*/
+	if ((EduRTOS_NULL != HigherPriorityTaskWoken) && (Edu_True == IsWokenUp) && (Edu_True == EduRTOS_IsHigherThanCurrentTask(TargetTaskId))){
+		*HigherPriorityTaskWoken = Edu_True;
+	}
+	EduRTOS_ExitCriticalFromISR(SavedMask);
+	return Status;
+}
+
+EduRTOS_StdType_Status EduRTOS_TaskNotifyWait(const Edu_u32 ClearBitsOnEntry, const Edu_u32 ClearBitsOnExit,
+		Edu_u32 * const Value, const Edu_u32 TicksToWait){
+	EduRTOS_StdType_Status Status = EduRTOS_StdType_Status_Timeout;
+
+	EduRTOS_EnterCritical();
+	const TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
+	if (Edu_True != EduRTOS_TCBsArray[TargetTaskId].NotificationPending){
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue &= ~ClearBitsOnEntry;
+		if (0 != TicksToWait){
+			EduRTOS_WaitForNotification(TicksToWait);
+		}
+	}
+
+	if (EduRTOS_NULL != Value){
+		*Value = EduRTOS_TCBsArray[TargetTaskId].NotificationValue;
+	}
+	if (Edu_True == EduRTOS_TCBsArray[TargetTaskId].NotificationPending){
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue &= ~ClearBitsOnExit;
+		EduRTOS_TCBsArray[TargetTaskId].NotificationPending = Edu_False;
+		Status = EduRTOS_StdType_Status_Succeed;
+	}
+	EduRTOS_ExitCritical();
+	return Status;
+}
+
+Edu_u32 EduRTOS_TaskNotifyTake(const Edu_Bool ClearOnExit, const Edu_u32 TicksToWait){
+	EduRTOS_EnterCritical();
+	const TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
+	if ((0 == EduRTOS_TCBsArray[TargetTaskId].NotificationValue) && (0 != TicksToWait)){
+		EduRTOS_WaitForNotification(TicksToWait);
+	}
+
+	const Edu_u32 Value = EduRTOS_TCBsArray[TargetTaskId].NotificationValue;
+	if (0 != Value){
+		EduRTOS_TCBsArray[TargetTaskId].NotificationValue = (Edu_True == ClearOnExit) ? 0 : (Value - 1);
 	}
+	EduRTOS_TCBsArray[TargetTaskId].NotificationPending = Edu_False;
+	EduRTOS_ExitCritical();
+	return Value;
 }
+#endif
 
 Edu_u32 EduRTOS_GetCurrentTickNumber(void){
 	return EduRTOS_CurrentTickNumber;
@@ -156,212 +989,468 @@ Edu_u32 EduRTOS_GetNumberOfCreatedTasks(void){
 }
 
 void EduRTOS_TaskDelayUntil(const Edu_u32 ticks){
-	__disable_irq();
-	TaskId TargetTaskId = EduRTOS_GetCurrentRunningTask();
-
-	EduRTOS_TCBsArray[TargetTaskId].TaskStatus = EduRTOS_TaskStatus_Blocked;
-	EduRTOS_TCBsArray[TargetTaskId].BlockingReason = EduTask_BlockingReason_WaitingTickTime;
-	EduRTOS_TCBsArray[TargetTaskId].WaitingTillTick = EduRTOS_GetCurrentTickNumber() + ticks;
-	__enable_irq();
-	EduRTOS_ContextSwitchingTrigger();
+	EduRTOS_EnterCritical();
+	EduRTOS_BlockCurrentTask(EduRTOS_NULL, EduTask_BlockingReason_WaitingTickTime, ticks);
+	(void)EduRTOS_WaitForWakeUp();
+}
 
+void EduRTOS_TaskYield(void){
+	EduRTOS_EnterCritical();
+	/*Task gets all its time slots next time it runs.*/
+	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots = 0;
+	/*Running task isn't stored in ready bitmap, so any set bit is another ready task.*/
+	if (0 != EduRTOS_ReadyGroupBitmap){
+		/*Task goes to tail of its ready list (even FIFO task), So other tasks of its priority run before it.*/
+		EduRTOS_SetTaskStatus(EduRTOS_CurrentRunningTask, EduRTOS_TaskStatus_Ready);
+		EduRTOS_ContextSwitchingTrigger();
+	}
+	EduRTOS_ExitCritical();
+}
 
+/* @brief  --> Return stacks of tasks that deleted themselves to stack region, It must be called inside critical section by another task.
+ * */
+static void EduRTOS_FreeTerminatedStacks(void){
+	while (!EduRTOS_ListIsEmpty(&EduRTOS_TerminatedTasksList)){
+		EduRTOS_ListItem * const Item = EduRTOS_ListGetHead(&EduRTOS_TerminatedTasksList);
+		const EduRTOS_TCB * const TCB = (const EduRTOS_TCB *)Item->Owner;
+		EduRTOS_ListRemove(Item);
+		EduRTOS_StackFree(TCB->StackBottom, TCB->StackSize);
+	}
 }
 
-TaskId EduRTOS_CreateTask(void (*TaskFunction) (),
-		Edu_u32 TaskPriority,
-		Edu_u32 TaskStackSize,
-		TaskParameters const * const TaskParameters
-){
+void EduRTOS_ReclaimDeletedTasks(void){
+	/*List is checked before entering critical section, as idle task calls it in its loop.*/
+	if (!EduRTOS_ListIsEmpty(&EduRTOS_TerminatedTasksList)){
+		EduRTOS_EnterCritical();
+		EduRTOS_FreeTerminatedStacks();
+		EduRTOS_ExitCritical();
+	}
+}
 
-	TaskId CreatedTaskId = EduRTOS_Config_MAX_NUMBER_OF_TASKS-TaskPriority;
-
-	/*Initialize and reserve stack frame for task.*/
-
-	StackFrameM4WithoutFPU *TaskStackFrame;
-	TaskStackFrame = (StackFrameM4WithoutFPU *)(EduRTOS_NextTopTaskStackAddress - sizeof(StackFrameM4WithoutFPU));
-	TaskStackFrame->r4 	= 0;
-	TaskStackFrame->r5 	= 0;
-	TaskStackFrame->r6 	= 0;
-	TaskStackFrame->r7 	= 0;
-	TaskStackFrame->r8 	= 0;
-	TaskStackFrame->r9 	= 0;
-	TaskStackFrame->r10 = 0;
-	TaskStackFrame->r11 = 0;
-	if (TaskParameters->parameters){
-		TaskStackFrame->r0  = TaskParameters->parameters[0];
-		TaskStackFrame->r1 	= TaskParameters->parameters[1];
-		TaskStackFrame->r2 	= TaskParameters->parameters[2];
-		TaskStackFrame->r3 	= TaskParameters->parameters[3];
+EduRTOS_StdType_Status EduRTOS_TaskDelete(const TaskId TargetTaskId){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
 	}
-	else{
-		TaskStackFrame->r0  = 0;
-		TaskStackFrame->r1 	= 0;
-		TaskStackFrame->r2 	= 0;
-		TaskStackFrame->r3 	= 0;
+	EduRTOS_EnterCritical();
+	/*Mutexes held by deleted task could never be unlocked.*/
+	if (!EduRTOS_ListIsEmpty(EduRTOS_TCBListHead(TargetTaskId, HeldMutexesList))){
+		EduRTOS_ExitCritical();
+		return EduRTOS_StdType_Status_Fail;
 	}
-	TaskStackFrame->r12 = 0;
-	TaskStackFrame->pc 	= (Edu_u32)TaskFunction;
-	TaskStackFrame->lr 	= 0;
-	TaskStackFrame->psr	= 0x1000000;
+	EduRTOS_RemoveFromWaitLists(TargetTaskId);
+	/*Task is removed from ready list if it's ready.*/
+	EduRTOS_SetTaskStatus(TargetTaskId, EduRTOS_TaskStatus_Deleted);
+	EduRTOS_TCBsArray[TargetTaskId].ValidTask = 0;
+	EduRTOS_NumberOfCreatedTasks--;
 
-	/*Set task as ready*/
-	EduRTOS_TCBsArray[CreatedTaskId].TaskStatus = EduRTOS_TaskStatus_Ready;
+	if (TargetTaskId == EduRTOS_CurrentRunningTask){
+		/*Task runs on its stack till context is switched, Delayed list item is free as task isn't waiting any more.*/
+		EduRTOS_ListInsertTail(&EduRTOS_TerminatedTasksList, EduRTOS_TCBListItem(TargetTaskId, DelayedListItem));
+		EduRTOS_ContextSwitchingTrigger();
+		EduRTOS_ExitCritical();
+		/*Deleted task never runs again.*/
+		while (1){}
+	}
+	EduRTOS_FreeTerminatedStacks();
+	EduRTOS_StackFree(EduRTOS_TCBsArray[TargetTaskId].StackBottom, EduRTOS_TCBsArray[TargetTaskId].StackSize);
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
 
-	EduRTOS_TCBsArray[CreatedTaskId].TaskIdentifier = CreatedTaskId;
-	/*Set task as valid*/
-	EduRTOS_TCBsArray[CreatedTaskId].ValidTask = 1;
-	/*Assign stask pointer for task*/
-	EduRTOS_TCBsArray[CreatedTaskId].pStackPointer = EduRTOS_NextTopTaskStackAddress;
-	/*Assign task priority*/
-	EduRTOS_TCBsArray[CreatedTaskId].Priority = TaskPriority;
-	/*Total timer slots of task = task priority*/
-	EduRTOS_TCBsArray[CreatedTaskId].TotalTimeSlots = TaskPriority;
-	/*At initialization, Finished time slots for a task equal zero.*/
-	EduRTOS_TCBsArray[CreatedTaskId].FinishedTimeSlots = 0;
-	/*Assign task function of a task*/
-	EduRTOS_TCBsArray[CreatedTaskId].Function = TaskFunction;
-	/*Reserve stack size of task & Calculate top stack for the next task.*/
-	EduRTOS_NextTopTaskStackAddress -= TaskStackSize;
-	EduRTOS_NumberOfCreatedTasks++;
+void EduRTOS_TaskSuspend(const TaskId TargetTaskId){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	/*Blocked task stops waiting, Its wait result is still timeout.*/
+	EduRTOS_RemoveFromWaitLists(TargetTaskId);
+	EduRTOS_SetTaskStatus(TargetTaskId, EduRTOS_TaskStatus_Suspended);
+	if (TargetTaskId == EduRTOS_CurrentRunningTask){
+		EduRTOS_ContextSwitchingTrigger();
+	}
+	EduRTOS_ExitCritical();
+}
 
-	return CreatedTaskId;
+void EduRTOS_TaskResume(const TaskId TargetTaskId){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	if (EduRTOS_TaskStatus_Suspended == EduRTOS_TCBsArray[TargetTaskId].TaskStatus){
+		EduRTOS_SetTaskStatus(TargetTaskId, EduRTOS_TaskStatus_Ready);
+		if (Edu_True == EduRTOS_IsHigherThanCurrentTask(TargetTaskId)){
+			EduRTOS_PreemptionTrigger();
+		}
+	}
+	EduRTOS_ExitCritical();
 }
 
-__attribute__ ((naked)) void RTOS_Start_Scheduler(void){
+void EduRTOS_TaskSetPriority(const TaskId TargetTaskId, const Edu_u32 NewPriority){
+	if ((TargetTaskId >= EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask) ||
+			(0 == NewPriority) || (NewPriority > EduRTOS_Config_MAX_PRIORITY)){
+		EduRTOS_ErrorHandler();
+	}
+	EduRTOS_EnterCritical();
+	EduRTOS_TCBsArray[TargetTaskId].Priority = NewPriority;
+	/*Task keeps priority inherited from mutexes that it holds, So effective priority may not change.*/
+	EduRTOS_UpdateEffectivePriority(TargetTaskId);
 
-	/*Get first valid task id in other words (Highest priority task)*/
-	for (Edu_u32 i = 0;i<EduRTOS_Config_MAX_NUMBER_OF_TASKS;i++){
-		if (EduRTOS_TCBsArray[i].ValidTask){
-			EduRTOS_CurrentRunningTask = i;
-			break;
+	if (TargetTaskId == EduRTOS_CurrentRunningTask){
+		/*Current task is lowered below another ready task.*/
+		if (EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_Config_MAX_PRIORITY + 1) > EduRTOS_TCBsArray[TargetTaskId].EffectivePriority){
+			EduRTOS_PreemptionTrigger();
 		}
 	}
-	/*Set stack pointer to highest priority task.*/
-	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Running;
-	__set_PSP(EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].pStackPointer-sizeof(StackFrameM4WithoutFPU));
-	/*Switch control to process stack pointer*/
-	__set_CONTROL(0x02);
-	__asm volatile ("pop {r4-r11}\n");
-	__asm volatile ("pop {r0-r3}\n");
-	__asm volatile ("pop {r12}\n");
-	__asm volatile ("pop {lr}\n");
-	__asm volatile ("pop {pc}\n");
+	else if ((EduRTOS_TaskStatus_Ready == EduRTOS_TCBsArray[TargetTaskId].TaskStatus) &&
+			(Edu_True == EduRTOS_IsHigherThanCurrentTask(TargetTaskId))){
+		EduRTOS_PreemptionTrigger();
+	}
+	EduRTOS_ExitCritical();
+}
 
-	__enable_irq();
+Edu_u32 EduRTOS_TaskGetPriority(const TaskId TargetTaskId){
+	if ((TargetTaskId > EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		EduRTOS_ErrorHandler();
+	}
+	return EduRTOS_TCBsArray[TargetTaskId].Priority;
 }
 
+Edu_u32 EduRTOS_GetFreeStackRegionSize(void){
+	EduRTOS_EnterCritical();
+	EduRTOS_FreeTerminatedStacks();
+	const Edu_u32 FreeSize = EduRTOS_StackGetFreeSize();
+	EduRTOS_ExitCritical();
+	return FreeSize;
+}
 
-void SysTick_Handler(void){
-	EduRTOS_CurrentTickNumber++;
-	Edu_u32 IsContextSwitchingRequired = 0;
+Edu_u32 EduRTOS_GetLargestFreeStackBlock(void){
+	EduRTOS_EnterCritical();
+	EduRTOS_FreeTerminatedStacks();
+	const Edu_u32 LargestSize = EduRTOS_StackGetLargestFreeBlock();
+	EduRTOS_ExitCritical();
+	return LargestSize;
+}
 
-	/*Find tasks that was blocked due to waiting tick time.*/
-	for (int i =0; i<EduRTOS_Config_MAX_NUMBER_OF_TASKS; i++){
-		/*Idle task*/
-		if (EduRTOS_Config_MAX_NUMBER_OF_TASKS == i){
-			continue;
-		}
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+void EduRTOS_TicklessIdle(void){
+	EduRTOS_EnterCritical();
 
-		if (!EduRTOS_TCBsArray[i].ValidTask){
-			continue;
-		}
-		if (EduRTOS_TaskStatus_Blocked != EduRTOS_TCBsArray[i].TaskStatus){
-			continue;
+	/*Don't sleep if any task (other than idle task) is ready.*/
+	if (0 != EduRTOS_ReadyGroupBitmap){
+		EduRTOS_ExitCritical();
+		return;
+	}
+
+	/*Number of ticks till wakeup tick of the nearest delayed task.*/
+	Edu_u32 ExpectedIdleTicks = EduRTOS_Port_MAX_SUPPRESSED_TICKS;
+	if (!EduRTOS_ListIsEmpty(&EduRTOS_DelayedTasksList)){
+		ExpectedIdleTicks = EduRTOS_ListGetHead(&EduRTOS_DelayedTasksList)->ItemValue - EduRTOS_CurrentTickNumber;
+		if ((Edu_s32)ExpectedIdleTicks < 0){
+			ExpectedIdleTicks = 0;
 		}
-		if (EduTask_BlockingReason_WaitingTickTime != EduRTOS_TCBsArray[i].BlockingReason){
-			continue;
+		else if (ExpectedIdleTicks > EduRTOS_Port_MAX_SUPPRESSED_TICKS){
+			ExpectedIdleTicks = EduRTOS_Port_MAX_SUPPRESSED_TICKS;
 		}
-		if (EduRTOS_TCBsArray[i].WaitingTillTick <= EduRTOS_GetCurrentTickNumber()){
-
-			EduRTOS_TCBsArray[i].TaskStatus = EduRTOS_TaskStatus_Ready;
-			/*
-			 * Check if this task has higher priority than current running task.
-			 * If so, do context switching
-			 * */
-			if (EduRTOS_TCBsArray[i].Priority > EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].Priority){
-				IsContextSwitchingRequired = 1;
+	}
+
+	if (ExpectedIdleTicks < EduRTOS_Config_TICKLESS_MIN_IDLE_TICKS){
+		EduRTOS_ExitCritical();
+		return;
+	}
+
+	/*Port sleeps till expected wakeup tick or any interrupt, and returns number of missed ticks.*/
+	const Edu_u32 CompletedTicks = EduRTOS_Port_SuppressTicksAndSleep(ExpectedIdleTicks, &EduRTOS_SleepCounts);
+
+	/* Add missed ticks, Wakeup tick of delayed tasks isn't reached (It's counted by tick handler),
+	 * so no task needs to be woken up.*/
+	EduRTOS_CurrentTickNumber += CompletedTicks;
+
+	EduRTOS_ExitCritical();
+}
+
+Edu_u32 EduRTOS_GetSleepTicks(void){
+	return (Edu_u32)(EduRTOS_SleepCounts / EduRTOS_Port_TIMER_COUNTS_PER_TICK);
+}
+
+Edu_u32 EduRTOS_GetSleepTimePercentage(void){
+	const Edu_u64 TotalCounts = (Edu_u64)EduRTOS_GetCurrentTickNumber() * EduRTOS_Port_TIMER_COUNTS_PER_TICK;
+	if (0 == TotalCounts){
+		return 0;
+	}
+	return (Edu_u32)((EduRTOS_SleepCounts * 100) / TotalCounts);
+}
+#endif
+
+#if EduRTOS_Config_USE_STACK_WATERMARK
+/*Minimum safety margin of suggested stack size, It's a context frame (r0-r12, lr, pc, psr, r4-r11) on ARM.*/
+#define EduRTOS_STACK_MIN_MARGIN			64UL
+
+Edu_u32 EduRTOS_GetTaskStackHighWaterMark(const TaskId TargetTaskId){
+	if ((TargetTaskId > EduRTOS_IDLE_TASK) || (!EduRTOS_TCBsArray[TargetTaskId].ValidTask)){
+		return 0;
+	}
+	/*Stack grows down, So untouched words are at its bottom.*/
+	const Edu_u32 * const StackBottom = (const Edu_u32 *)EduRTOS_TCBsArray[TargetTaskId].StackBottom;
+	const Edu_u32 StackWords = EduRTOS_TCBsArray[TargetTaskId].StackSize / sizeof(Edu_u32);
+	Edu_u32 UnusedWords = 0;
+	while ((UnusedWords < StackWords) && (EduRTOS_STACK_FILL_PATTERN == StackBottom[UnusedWords])){
+		UnusedWords++;
+	}
+	return (StackWords - UnusedWords) * sizeof(Edu_u32);
+}
+
+Edu_u32 EduRTOS_GetStackReport(EduRTOS_StackReport * const Reports, const Edu_u32 MaxNumberOfReports){
+	Edu_u32 NumberOfReports = 0;
+
+	for (TaskId i = 0; (i <= EduRTOS_IDLE_TASK) && (NumberOfReports < MaxNumberOfReports); i++){
+		if (EduRTOS_TCBsArray[i].ValidTask){
+			const Edu_u32 MaxUsed = EduRTOS_GetTaskStackHighWaterMark(i);
+			Edu_u32 Margin = (MaxUsed * EduRTOS_Config_STACK_MARGIN_PERCENT) / 100;
+			if (Margin < EduRTOS_STACK_MIN_MARGIN){
+				Margin = EduRTOS_STACK_MIN_MARGIN;
 			}
+			Reports[NumberOfReports].Id = i;
+			Reports[NumberOfReports].Priority = EduRTOS_TCBsArray[i].Priority;
+			Reports[NumberOfReports].StackSize = EduRTOS_TCBsArray[i].StackSize;
+			Reports[NumberOfReports].MaxUsed = MaxUsed;
+			Reports[NumberOfReports].SuggestedSize = EduRTOS_Port_StackSize(MaxUsed + Margin);
+			Reports[NumberOfReports].IsOverflowed = (MaxUsed >= EduRTOS_TCBsArray[i].StackSize) ? Edu_True : Edu_False;
+			NumberOfReports++;
 		}
 	}
 
-	/*If task finished all it's time slots, trigger context switching
-	 * Otherwise increase FinishedTimeSlots by 1*/
-	if (EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TotalTimeSlots == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots){
-		if (EduRTOS_TaskStatus_Running == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus ){
-			EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Ready;
-		}
-		else{
+	return NumberOfReports;
+}
+#endif
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+Edu_u32 EduRTOS_GetTasksStats(EduRTOS_TaskStats * const Stats, const Edu_u32 MaxNumberOfStats){
+	Edu_u32 NumberOfStats = 0;
+	Edu_u64 TotalRunTime = 0;
 
+	EduRTOS_EnterCritical();
+	EduRTOS_UpdateRunTime();
+	for (TaskId i = 0; i <= EduRTOS_IDLE_TASK; i++){
+		if (EduRTOS_TCBsArray[i].ValidTask){
+			TotalRunTime += EduRTOS_TCBsArray[i].RunTimeCounts;
+		}
+	}
+	for (TaskId i = 0; (i <= EduRTOS_IDLE_TASK) && (NumberOfStats < MaxNumberOfStats); i++){
+		if (EduRTOS_TCBsArray[i].ValidTask){
+			Stats[NumberOfStats].Id = i;
+			Stats[NumberOfStats].Priority = EduRTOS_TCBsArray[i].Priority;
+			Stats[NumberOfStats].Status = EduRTOS_TCBsArray[i].TaskStatus;
+			Stats[NumberOfStats].RunTime = EduRTOS_TCBsArray[i].RunTimeCounts;
+			Stats[NumberOfStats].SwitchInCount = EduRTOS_TCBsArray[i].SwitchInCount;
+			Stats[NumberOfStats].CpuPercentage = (0 == TotalRunTime) ? 0 :
+					(Edu_u32)((EduRTOS_TCBsArray[i].RunTimeCounts * 100) / TotalRunTime);
+			NumberOfStats++;
 		}
-		EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots = 0;
-		IsContextSwitchingRequired = 1;
+	}
+	EduRTOS_ExitCritical();
+
+	return NumberOfStats;
+}
+
+Edu_u32 EduRTOS_GetCpuLoadPercentage(void){
+	Edu_u64 TotalRunTime = 0;
 
+	EduRTOS_EnterCritical();
+	EduRTOS_UpdateRunTime();
+	for (TaskId i = 0; i <= EduRTOS_IDLE_TASK; i++){
+		if (EduRTOS_TCBsArray[i].ValidTask){
+			TotalRunTime += EduRTOS_TCBsArray[i].RunTimeCounts;
+		}
 	}
-	else{
-		EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots++;
+	const Edu_u64 IdleRunTime = EduRTOS_TCBsArray[EduRTOS_IDLE_TASK].RunTimeCounts;
+	EduRTOS_ExitCritical();
+
+	if (0 == TotalRunTime){
+		return 0;
 	}
+	return (Edu_u32)(100 - ((IdleRunTime * 100) / TotalRunTime));
+}
 
-	if (IsContextSwitchingRequired){
-		EduRTOS_ContextSwitchingTrigger();
+void EduRTOS_ResetRuntimeStats(void){
+	EduRTOS_EnterCritical();
+	for (TaskId i = 0; i <= EduRTOS_IDLE_TASK; i++){
+		EduRTOS_TCBsArray[i].RunTimeCounts = 0;
+		EduRTOS_TCBsArray[i].SwitchInCount = 0;
 	}
+	EduRTOS_RunTimeStartTimestamp = EduRTOS_Port_Timestamp();
+	EduRTOS_ExitCritical();
 }
+#endif
 
-__attribute__ ((naked)) void PendSV_Handler(void){
-	__disable_irq();
-	Edu_u32 FoundTaskInReadyState = 0;
+TaskId EduRTOS_CreateTask(void (*TaskFunction) (),
+		Edu_u32 TaskPriority,
+		Edu_u32 TaskStackSize,
+		TaskParameters const * const TaskParameters
+){
+	return EduRTOS_CreateTaskWithPolicy(TaskFunction, TaskPriority, TaskStackSize, TaskParameters,
+			EduTask_SchedPolicy_RoundRobin, EduRTOS_Config_TIME_SLICE_TICKS);
+}
 
-	asm volatile ("MRS r0, PSP");
-	asm volatile ("STMDB r0!, {r4-r11}");
-	asm volatile ("MSR psp, r0");
-	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].pStackPointer = __get_PSP()+sizeof(StackFrameM4WithoutFPU);
+TaskId EduRTOS_CreateTaskWithPolicy(void (*TaskFunction) (),
+		Edu_u32 TaskPriority,
+		Edu_u32 TaskStackSize,
+		TaskParameters const * const TaskParameters,
+		const EduTask_SchedPolicy SchedPolicy,
+		const Edu_u32 TimeSliceTicks
+){
+	/*Priority 0 is reserved for idle task, It's the first created task (EduRTOS_Init).*/
+	if ((TaskPriority > EduRTOS_Config_MAX_PRIORITY) || ((0 == TaskPriority) && (EduRTOS_TCBsArray[EduRTOS_IDLE_TASK].ValidTask))){
+		EduRTOS_ErrorHandler();
+	}
 
-	/*Circular loop to Search for next task to run.
-	 * And avoid selecting current task.
-	 * when this function is called it's must to do context switching, so avoid choosing current task.*/
-	for (Edu_u32 i = (((EduRTOS_CurrentRunningTask+1) >= EduRTOS_Config_MAX_NUMBER_OF_TASKS) ? 0 : (EduRTOS_CurrentRunningTask+1))
-			; i != EduRTOS_CurrentRunningTask;
-			i++){
+	/*Port may enlarge or align stack size.*/
+	TaskStackSize = EduRTOS_Port_StackSize(TaskStackSize);
 
-		/*Idle task*/
-		if (EduRTOS_Config_MAX_NUMBER_OF_TASKS == i){
-			i = 0;
-			continue;
+	/*Task may be created by running task, so TCB and ready bitmap are updated inside critical section.*/
+	EduRTOS_EnterCritical();
+	/*Stacks of deleted tasks are reused before new stack is allocated.*/
+	EduRTOS_FreeTerminatedStacks();
+	/*Idle task has the last TCB, Other tasks take the first free TCB.*/
+	TaskId CreatedTaskId = EduRTOS_IDLE_TASK;
+	if (0 != TaskPriority){
+		CreatedTaskId = 0;
+		while ((CreatedTaskId < EduRTOS_IDLE_TASK) && (EduRTOS_TCBsArray[CreatedTaskId].ValidTask)){
+			CreatedTaskId++;
+		}
+		if (EduRTOS_IDLE_TASK == CreatedTaskId){
+			/*All EduRTOS_Config_MAX_NUMBER_OF_TASKS TCBs are used.*/
+			EduRTOS_ExitCritical();
+			return EduRTOS_INVALID_TASK;
 		}
+	}
+	/*Size may be enlarged by allocator to whole free block.*/
+	Edu_u8 * const StackBottom = EduRTOS_StackAllocate(&TaskStackSize);
+	if (EduRTOS_NULL == StackBottom){
+		EduRTOS_ExitCritical();
+		return EduRTOS_INVALID_TASK;
+	}
+	EduRTOS_TCBsArray[CreatedTaskId].StackBottom = StackBottom;
+	EduRTOS_TCBsArray[CreatedTaskId].StackSize = TaskStackSize;
+#if EduRTOS_Config_USE_STACK_WATERMARK
+	/*Fill stack with pattern before its initial context is stored at its top.*/
+	for (Edu_u32 i = 0; i < (TaskStackSize / sizeof(Edu_u32)); i++){
+		((Edu_u32 *)StackBottom)[i] = EduRTOS_STACK_FILL_PATTERN;
+	}
+#endif
+	EduRTOS_TCBsArray[CreatedTaskId].TaskIdentifier = CreatedTaskId;
+	/*Set task as valid*/
+	EduRTOS_TCBsArray[CreatedTaskId].ValidTask = 1;
+	/*Initialize context of task on its stack, and assign its saved context (stack pointer).*/
+	EduRTOS_TCBsArray[CreatedTaskId].pStackPointer = EduRTOS_Port_InitTaskStack(StackBottom + TaskStackSize, TaskStackSize,
+			TaskFunction, (EduRTOS_NULL != TaskParameters) ? TaskParameters->parameters : EduRTOS_NULL);
+	/*Assign task priority*/
+	EduRTOS_TCBsArray[CreatedTaskId].Priority = TaskPriority;
+	/*Task runs at its own priority till it inherits priority through mutexes.*/
+	EduRTOS_TCBsArray[CreatedTaskId].EffectivePriority = TaskPriority;
+	EduRTOS_TCBsArray[CreatedTaskId].SchedPolicy = SchedPolicy;
+	EduRTOS_TCBsArray[CreatedTaskId].TimeSliceTicks = TimeSliceTicks;
+	/*Total time slots of task from its time slice (task priority by default)*/
+	EduRTOS_UpdateTimeSlots(CreatedTaskId);
+	/*At initialization, Finished time slots for a task equal zero.*/
+	EduRTOS_TCBsArray[CreatedTaskId].FinishedTimeSlots = 0;
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	/*TCB may be used before by deleted task.*/
+	EduRTOS_TCBsArray[CreatedTaskId].RunTimeCounts = 0;
+	EduRTOS_TCBsArray[CreatedTaskId].SwitchInCount = 0;
+#endif
+	/*Assign task function of a task*/
+	EduRTOS_TCBsArray[CreatedTaskId].Function = TaskFunction;
+	/*Task isn't inserted in any list yet.*/
+	EduRTOS_ListItemInit(EduRTOS_TCBListItem(CreatedTaskId, DelayedListItem), (void *)&EduRTOS_TCBsArray[CreatedTaskId]);
+	EduRTOS_ListItemInit(EduRTOS_TCBListItem(CreatedTaskId, EventListItem), (void *)&EduRTOS_TCBsArray[CreatedTaskId]);
+	EduRTOS_ListItemInit(EduRTOS_TCBListItem(CreatedTaskId, ReadyListItem), (void *)&EduRTOS_TCBsArray[CreatedTaskId]);
+	EduRTOS_ListInit(EduRTOS_TCBListHead(CreatedTaskId, HeldMutexesList));
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+	EduRTOS_TCBsArray[CreatedTaskId].NotificationValue = 0;
+	EduRTOS_TCBsArray[CreatedTaskId].NotificationPending = Edu_False;
+#endif
+	/*Set task as ready, It must be done after assigning priority as it's used by ready lists.*/
+	EduRTOS_SetTaskStatus(CreatedTaskId, EduRTOS_TaskStatus_Ready);
+	EduRTOS_NumberOfCreatedTasks++;
+	EduRTOS_TRACE(EduRTOS_TraceEvent_TaskCreate, CreatedTaskId, (Edu_u8)TaskPriority);
+	EduRTOS_ExitCritical();
+
+	return CreatedTaskId;
+}
 
-		if (EduRTOS_TCBsArray[i].ValidTask && (EduRTOS_TaskStatus_Ready == EduRTOS_TCBsArray[i].TaskStatus)){
+void RTOS_Start_Scheduler(void){
 
-			if (EduRTOS_TaskStatus_Running == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus){
-				EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Ready;
-			}
+	/*Start with head of ready list of highest priority (Idle task if no task is created).*/
+	const Edu_u32 HighestPriority = EduRTOS_ReadyBitmap_HighestBelow(EduRTOS_Config_MAX_PRIORITY + 1);
+	EduRTOS_CurrentRunningTask = (0 == HighestPriority) ? EduRTOS_IDLE_TASK :
+			((EduRTOS_TCB *)EduRTOS_ListGetHead(&EduRTOS_ReadyLists[HighestPriority])->Owner)->TaskIdentifier;
+	EduRTOS_SetTaskStatus(EduRTOS_CurrentRunningTask, EduRTOS_TaskStatus_Running);
+	EduRTOS_NextTCB = (EduRTOS_TCB *)&EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask];
+	EduRTOS_CurrentTCB = EduRTOS_NextTCB;
+	EduRTOS_TRACE(EduRTOS_TraceEvent_Switch, EduRTOS_CurrentRunningTask, 0);
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].SwitchInCount++;
+	EduRTOS_RunTimeStartTimestamp = EduRTOS_Port_Timestamp();
+#endif
+
+	/*Start tick and restore context of highest priority task.*/
+	EduRTOS_Port_StartScheduler();
+}
+
+Edu_Bool EduRTOS_TickIncrement(void){
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	EduRTOS_UpdateRunTime();
+#endif
+	EduRTOS_CurrentTickNumber++;
+	Edu_Bool IsContextSwitchingRequired = Edu_False;
+	/*Woken task that is higher than current task runs right away, even if time slice of current task is over too.*/
+	Edu_Bool IsPreemption = Edu_False;
 
-			EduRTOS_CurrentRunningTask = i;
-			FoundTaskInReadyState = 1;
+	/* Wake up tasks that their wakeup tick has come.
+	 * List is sorted by wakeup tick, so stop at first task that still has to wait.
+	 * Difference of ticks is compared as signed value to handle overflow of tick counter.
+	 * */
+	while (!EduRTOS_ListIsEmpty(&EduRTOS_DelayedTasksList)){
+		EduRTOS_ListItem * const DelayedItem = EduRTOS_ListGetHead(&EduRTOS_DelayedTasksList);
+		if ((Edu_s32)(EduRTOS_GetCurrentTickNumber() - DelayedItem->ItemValue) < 0){
 			break;
 		}
+		const TaskId WakeupTaskId = ((EduRTOS_TCB *)DelayedItem->Owner)->TaskIdentifier;
 
-	}
-	/*In case of no available task to run, run idle task.*/
-	if (!FoundTaskInReadyState){
-		if (EduRTOS_TaskStatus_Running == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus){
-			EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Ready;
+		/*Task that waits object (Mutex, Semaphore) is removed from its wait list, and it's woken up with timeout.*/
+		EduRTOS_WakeUpTask(WakeupTaskId, EduRTOS_StdType_Status_Timeout);
+		/*
+		 * Check if this task has higher priority than current running task.
+		 * If so, do context switching
+		 * */
+		if (Edu_True == EduRTOS_IsHigherThanCurrentTask(WakeupTaskId)){
+			IsContextSwitchingRequired = Edu_True;
+			IsPreemption = Edu_True;
 		}
-		EduRTOS_CurrentRunningTask = EduRTOS_Config_MAX_NUMBER_OF_TASKS;
-	}
-	else{
-		EduRTOS_TCBsArray[EduRTOS_Config_MAX_NUMBER_OF_TASKS].TaskStatus = EduRTOS_TaskStatus_Ready;
 	}
 
+	/*FIFO task isn't time sliced, It runs till it blocks or yields.*/
+	if (EduTask_SchedPolicy_RoundRobin == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].SchedPolicy){
+		/*If task finished all it's time slots (Its time slots may decrease when inherited priority is restored), it goes to
+		 * tail of its ready list and context switching is triggered, If no other task is ready it continues running.
+		 * Otherwise increase FinishedTimeSlots by 1*/
+		if (EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots >= EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TotalTimeSlots){
+			EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots = 0;
+			if ((0 != EduRTOS_ReadyGroupBitmap) && (EduRTOS_TaskStatus_Running == EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus)){
+				EduRTOS_SetTaskStatus(EduRTOS_CurrentRunningTask, EduRTOS_TaskStatus_Ready);
+				IsContextSwitchingRequired = Edu_True;
+			}
+		}
+		else{
+			EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].FinishedTimeSlots++;
+		}
+	}
 
-	EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].TaskStatus = EduRTOS_TaskStatus_Running;
-
-	__set_PSP(EduRTOS_TCBsArray[EduRTOS_CurrentRunningTask].pStackPointer-sizeof(StackFrameM4WithoutFPU));
-
-	asm volatile ("MRS r0, psp \n");
-	asm volatile ("LDMFD r0!, {r4-r11}\n");
-	asm volatile ("MSR psp, r0\n");
-	__enable_irq();
-	asm volatile ("BX lr");
+	/*Next task is selected here, and port requests context switching.*/
+	if (Edu_True == IsContextSwitchingRequired){
+		EduRTOS_SelectNextTask(IsPreemption);
+	}
+	return IsContextSwitchingRequired;
 }
 
 
@@ -15,10 +15,10 @@
 ==================================================
  */
 #include <stdint.h>
-#include "stm32f401xc.h"
 #include "EduRTOS_Config.h"
 #include "EduRTOS_defines.h"
 #include "EduRTOS.h"
+#include "List/list.h"
 
 #if EduRTOS_Config_USE_MUTEX
 	#include "Mutex/mutex.h"
@@ -32,6 +32,14 @@
 	#include "Mailbox/mailbox.h"
 #endif
 
+#if EduRTOS_Config_USE_EVENT_GROUP
+	#include "EventGroup/eventgroup.h"
+#endif
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+	#include "MemoryPool/memorypool.h"
+#endif
+
 /*
 ==================================================
   End Section --> File Includes
@@ -42,45 +50,64 @@ typedef enum{
 	EduRTOS_TaskStatus_Ready,
 	EduRTOS_TaskStatus_Blocked,
 	EduRTOS_TaskStatus_Suspended,
+	/*Task is deleted, Its TCB and stack are free.*/
+	EduRTOS_TaskStatus_Deleted,
 }EduTask_Status;
 
 typedef Edu_u32 TaskId;
 
+/*Scheduling policy of task among ready tasks of its priority.*/
+typedef enum{
+	/*Task runs for its time slice, then it goes to tail of ready list of its priority.*/
+	EduTask_SchedPolicy_RoundRobin,
+	/*Task isn't time sliced, It runs till it blocks or yields, and it stays at head of its ready list when it's preempted.*/
+	EduTask_SchedPolicy_FIFO,
+}EduTask_SchedPolicy;
+
 typedef enum {
 	EduTask_BlockingReason_WaitingTickTime,
 	EduTask_BlockingReason_MutexLocked,
 	EduTask_BlockingReason_SemaphoreLocked,
+	EduTask_BlockingReason_WaitingNotification,
+	EduTask_BlockingReason_WaitingEvents,
+	EduTask_BlockingReason_WaitingMemoryBlock,
 }EduTask_BlockingReason;
 
-typedef struct {
-	/*Pushed by software*/
-	Edu_u32 r4;
-	Edu_u32 r5;
-	Edu_u32 r6;
-	Edu_u32 r7;
-	Edu_u32 r8;
-	Edu_u32 r9;
-	Edu_u32 r10;
-	Edu_u32 r11;
-
-	/*Pushed by hardware*/
-	Edu_u32 r0;
-	Edu_u32 r1;
-	Edu_u32 r2;
-	Edu_u32 r3;
-	Edu_u32 r12;
-	Edu_u32 lr;
-	Edu_u32 pc;
-	Edu_u32 psr;
-}StackFrameM4WithoutFPU;
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+/*Update of notification value of target task by EduRTOS_TaskNotify.*/
+typedef enum {
+	/*Value is unchanged, Task is only signalled.*/
+	EduTask_Notify_NoAction,
+	/*Value is ORed with passed value (Event flags).*/
+	EduTask_Notify_SetBits,
+	/*Value is incremented, passed value is ignored (Counting semaphore).*/
+	EduTask_Notify_Increment,
+	/*Value is overwritten by passed value even if previous notification isn't received yet (Mailbox of one item).*/
+	EduTask_Notify_Overwrite,
+	/*Value is written only if previous notification is received, Otherwise notify fails.*/
+	EduTask_Notify_SetValue,
+}EduTask_NotifyAction;
+#endif
 
 typedef struct {
+	/*Saved context of task (Stack pointer on ARM), It must be first member as it's accessed by port assembly.*/
+	Edu_uptr pStackPointer;
 	EduTask_BlockingReason BlockingReason;
 	Edu_u32  ValidTask;
 	Edu_u32  WaitingTillTick;
+	/*Result of last blocking (Succeed if object is acquired, Timeout if wakeup tick has come).*/
+	EduRTOS_StdType_Status WaitResult;
+	/*Links task in delayed tasks list while it's waiting tick time.*/
+	EduRTOS_ListItem DelayedListItem;
+	/*Links task in wait list of object (Mutex, Semaphore) that blocks it.*/
+	EduRTOS_ListItem EventListItem;
+	/*Links task in ready list of its effective priority while it's ready (not running), ItemValue is the priority of list.*/
+	EduRTOS_ListItem ReadyListItem;
 
 #if EduRTOS_Config_USE_MUTEX
 	Mutex *BlockingMutex;
+	/*Mutexes locked by task, used to restore its priority when one of them is released.*/
+	EduRTOS_List HeldMutexesList;
 #endif
 
 #if EduRTOS_Config_USE_SEMAPHORE
@@ -91,17 +118,90 @@ typedef struct {
 	MailBox *BlockingMailBox;
 #endif
 
+#if EduRTOS_Config_USE_EVENT_GROUP
+	/*Wait condition of task while it's blocked on event group.*/
+	Edu_u32  WaitedEvents;
+	Edu_Bool WaitAllEvents;
+	Edu_Bool ClearEventsOnExit;
+	/*Events of event group when wait condition is met, They are returned to task.*/
+	Edu_u32  ReceivedEvents;
+#endif
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+	/*Block of memory pool that is given to task by task or interrupt that frees it.*/
+	void    *ReceivedMemoryBlock;
+#endif
+
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+	Edu_u32  NotificationValue;
+	/*Task is notified and it hasn't received notification yet.*/
+	Edu_Bool NotificationPending;
+#endif
+
 	TaskId	  TaskIdentifier;
+	/*Base priority assigned at task creation or by EduRTOS_TaskSetPriority.*/
 	Edu_u32  Priority;
+	/*Priority used at runtime, It's higher than base priority while task inherits priority through mutexes.*/
+	Edu_u32  EffectivePriority;
+	EduTask_SchedPolicy SchedPolicy;
+	/*Time slice in ticks, or EduRTOS_TIME_SLICE_BY_PRIORITY (Round-robin policy only).*/
+	Edu_u32  TimeSliceTicks;
 	Edu_u32  TotalTimeSlots;
 	Edu_u32  FinishedTimeSlots;
 	EduTask_Status TaskStatus;
-	Edu_u32 pStackPointer;
 	void (*Function) () ;
+	/*Lowest address and size of task stack, Stack grows down towards StackBottom. It's returned to stack region when task is deleted.*/
+	Edu_u8  *StackBottom;
+	Edu_u32  StackSize;
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+	/*Time that task spent running in port timestamp counts.*/
+	Edu_u64  RunTimeCounts;
+	/*Number of times task is switched in.*/
+	Edu_u32  SwitchInCount;
+#endif
 } EduRTOS_TCB;
 
+#if EduRTOS_Config_USE_STACK_WATERMARK
+/*Stack usage of task, It's filled by EduRTOS_GetStackReport.*/
+typedef struct{
+	TaskId	  Id;
+	Edu_u32  Priority;
+	/*Reserved stack size in bytes.*/
+	Edu_u32  StackSize;
+	/*Maximum number of bytes used since creation of task (High water mark).*/
+	Edu_u32  MaxUsed;
+	/*High water mark + safety margin, aligned and enlarged by port (EduRTOS_Port_StackSize).*/
+	Edu_u32  SuggestedSize;
+	/*Pattern at bottom of stack is overwritten, so stack may have overflowed.*/
+	Edu_Bool IsOverflowed;
+}EduRTOS_StackReport;
+#endif
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+/*Runtime statistics of task, It's filled by EduRTOS_GetTasksStats.*/
+typedef struct{
+	TaskId	  Id;
+	Edu_u32  Priority;
+	EduTask_Status Status;
+	/*Time that task spent running in port timestamp counts (EduRTOS_Port_TIMESTAMP_HZ counts in one second).*/
+	Edu_u64  RunTime;
+	Edu_u32  SwitchInCount;
+	/*Percentage of run time of task from run time of all tasks (0 to 100).*/
+	Edu_u32  CpuPercentage;
+}EduRTOS_TaskStats;
+#endif
+
+/*TCB whose context is on processor, It's used by port to save and restore context.*/
+extern EduRTOS_TCB * volatile EduRTOS_CurrentTCB;
+
+/*TCB of task selected by kernel to run, Port copies it to EduRTOS_CurrentTCB when it switches context.*/
+extern EduRTOS_TCB * volatile EduRTOS_NextTCB;
+
 
 /* Examples are documented in detail please visit github repository of EduRTOS
+ * Note parameters are passed to task as four 32-bit words, So on 64-bit hosts (POSIX port)
+ * pointers and 64-bit arguments can't be passed.
  * */
 typedef union{
 	struct{
@@ -155,6 +255,14 @@ typedef union{
 	Edu_u32 parameters[4];
 } TaskParameters;
 
+/* @brief  				 --> Create round-robin task with time slice "EduRTOS_Config_TIME_SLICE_TICKS".
+ * @param  TaskFunction  --> Function of task.
+ * @param  TaskPriority  --> Priority from 1 to EduRTOS_Config_MAX_PRIORITY, It may be shared by other tasks.
+ * @param  TaskStackSize --> Stack size in bytes.
+ * @param  TaskParameters --> Parameters passed to task function, It may be NULL.
+ * @retval --> Id of created task, It's index of free TCB (not related to priority),
+ * or EduRTOS_INVALID_TASK if all TCBs are used or there is no free block of stack region that fits stack.
+ * */
 TaskId EduRTOS_CreateTask(
 		void (*TaskFunction) (),
 		Edu_u32 TaskPriority,
@@ -162,14 +270,279 @@ TaskId EduRTOS_CreateTask(
 		TaskParameters const * const TaskParameters
 );
 
+/* @brief  				  --> Create task with scheduling policy among tasks of the same priority.
+ * @param  TaskFunction   --> Function of task.
+ * @param  TaskPriority   --> Priority from 1 to EduRTOS_Config_MAX_PRIORITY, It may be shared by other tasks.
+ * @param  TaskStackSize  --> Stack size in bytes.
+ * @param  TaskParameters --> Parameters passed to task function, It may be NULL.
+ * @param  SchedPolicy 	  --> EduTask_SchedPolicy_RoundRobin or EduTask_SchedPolicy_FIFO.
+ * @param  TimeSliceTicks --> Time slice of round-robin task in ticks, or EduRTOS_TIME_SLICE_BY_PRIORITY (It's ignored by FIFO policy).
+ * @retval --> Id of created task, or EduRTOS_INVALID_TASK.
+ * */
+TaskId EduRTOS_CreateTaskWithPolicy(
+		void (*TaskFunction) (),
+		Edu_u32 TaskPriority,
+		Edu_u32 TaskStackSize,
+		TaskParameters const * const TaskParameters,
+		const EduTask_SchedPolicy SchedPolicy,
+		const Edu_u32 TimeSliceTicks
+);
+
+/* @brief  				--> Delete task, It's removed from all lists and its TCB and stack are returned to kernel.
+ * Task may delete itself, Then its stack is freed by idle task (or at next task creation or deletion), as it runs on it till context is switched.
+ * @param  TargetTaskId --> Id of task, Idle task can't be deleted.
+ * @retval --> EduRTOS_StdType_Status_Fail if task holds mutex (It would be locked forever), Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskDelete(const TaskId TargetTaskId);
+
+/* @brief  --> Free stacks of tasks that deleted themselves, It's called by idle task.
+ * */
+void EduRTOS_ReclaimDeletedTasks(void);
+
+/* @brief  				--> Suspend task till it's resumed, Task may suspend itself.
+ * If task is blocked it stops waiting, and its blocking API returns timeout once it's resumed.
+ * @param  TargetTaskId --> Id of task, Idle task can't be suspended.
+ * */
+void EduRTOS_TaskSuspend(const TaskId TargetTaskId);
+
+/* @brief  				--> Resume suspended task, It's ready again and it runs now if it has higher priority than current task.
+ * @param  TargetTaskId --> Id of task.
+ * */
+void EduRTOS_TaskResume(const TaskId TargetTaskId);
+
+/* @brief  				--> Change base priority of task at runtime, Task is moved to ready list of its new priority (or reordered
+ * in wait list of object that it waits), and context is switched now if a ready task becomes higher than current task.
+ * Task that holds mutex keeps inherited (or ceiling) priority till it releases mutex.
+ * @param  TargetTaskId --> Id of task, Priority of idle task can't be changed.
+ * @param  NewPriority 	--> New priority from 1 to EduRTOS_Config_MAX_PRIORITY.
+ * */
+void EduRTOS_TaskSetPriority(const TaskId TargetTaskId, const Edu_u32 NewPriority);
+
+/* @brief  				--> Get base priority of task (given at creation or by EduRTOS_TaskSetPriority), It doesn't include inherited priority.
+ * @param  TargetTaskId --> Id of task.
+ * @retval --> Priority of task.
+ * */
+Edu_u32 EduRTOS_TaskGetPriority(const TaskId TargetTaskId);
+
+/* @brief  --> Get number of free bytes of tasks stack region.
+ * @retval --> Number of bytes.
+ * */
+Edu_u32 EduRTOS_GetFreeStackRegionSize(void);
+
+/* @brief  --> Get size of the largest stack that can be allocated now, It's size of the largest free block of tasks stack region
+ * (or LargestFreeBlock of heap statistics if stacks are allocated from heap).
+ * @retval --> Number of bytes.
+ * */
+Edu_u32 EduRTOS_GetLargestFreeStackBlock(void);
+
 void RTOS_Start_Scheduler(void);
+/* @brief  		--> Block current task for number of ticks.
+ * @param  ticks --> Number of ticks to wait, It must be less than 0x80000000 or EduRTOS_INFINITE to block forever.
+ * */
 void EduRTOS_TaskDelayUntil(const Edu_u32 ticks);
 
-void EduRTOS_TaskBlock_Mutex(Mutex * const Arg_Mutex);
-void EduRTOS_TaskBlock_Semaphore(Semaphore * const Arg_Semaphore);
+/* @brief  --> Give up rest of time slots of current task, It goes to tail of ready list of its priority (whatever its policy is)
+ * and next task in round-robin order runs. If there is no other ready task (except idle task), current task continues running.
+ * */
+void EduRTOS_TaskYield(void);
+
+/* @brief  				--> Lock mutex by current task and apply mutex protocol (Inheritance / Ceiling).
+ * If mutex is locked, task is blocked till holder hands mutex over to it or timeout.
+ * @param  Arg_Mutex 	--> Pointer of mutex.
+ * @param  TicksToWait 	--> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> EduRTOS_StdType_Status_Succeed if mutex is locked by current task, Otherwise EduRTOS_StdType_Status_Timeout.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskLock_Mutex(Mutex * const Arg_Mutex, const Edu_u32 TicksToWait);
+
+/* @brief  			 --> Unlock mutex held by current task, and restore priority of current task.
+ * If tasks wait mutex, It's handed over to highest priority one of them.
+ * @param  Arg_Mutex --> Pointer of mutex.
+ * @retval --> EduRTOS_StdType_Status_Fail if mutex is held by another task, Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskUnLock_Mutex(Mutex * const Arg_Mutex);
+
+/* @brief  				 --> Take semaphore by current task.
+ * If semaphore value is zero, task is blocked till semaphore is given to it or timeout.
+ * @param  Arg_Semaphore --> Pointer of semaphore.
+ * @param  TicksToWait 	 --> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> EduRTOS_StdType_Status_Succeed if semaphore is taken, Otherwise EduRTOS_StdType_Status_Timeout.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskTake_Semaphore(Semaphore * const Arg_Semaphore, const Edu_u32 TicksToWait);
+
+/* @brief  				 --> Give semaphore, If tasks wait semaphore, It's given to highest priority one of them.
+ * @param  Arg_Semaphore --> Pointer of semaphore.
+ * */
+void EduRTOS_TaskGive_Semaphore(Semaphore * const Arg_Semaphore);
+
+/* @brief  				 --> Take semaphore from interrupt handler, It never blocks.
+ * @param  Arg_Semaphore --> Pointer of semaphore.
+ * @retval --> EduRTOS_StdType_Status_Succeed if semaphore is taken, Otherwise EduRTOS_StdType_Status_Timeout.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskTake_SemaphoreFromISR(Semaphore * const Arg_Semaphore);
+
+/* @brief  							--> Give semaphore from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_Semaphore 			--> Pointer of semaphore.
+ * @param  HigherPriorityTaskWoken 	--> It's set to Edu_True if woken task has higher priority than interrupted task (It's never cleared),
+ * 										So it's initialized by Edu_False and passed to EduRTOS_YieldFromISR at end of handler. It may be NULL.
+ * */
+void EduRTOS_TaskGive_SemaphoreFromISR(Semaphore * const Arg_Semaphore, Edu_Bool * const HigherPriorityTaskWoken);
+
+/* @brief  							--> Request context switching once at end of interrupt handler, if any FromISR API woke up higher priority task.
+ * Context isn't switched unless ready task is still higher than current task, So flag of nested interrupt that is already served doesn't switch it.
+ * @param  HigherPriorityTaskWoken 	--> Flag that is set by FromISR APIs.
+ * */
+void EduRTOS_YieldFromISR(const Edu_Bool HigherPriorityTaskWoken);
+
+#if EduRTOS_Config_USE_EVENT_GROUP
+/* @brief  					--> Wait events of event group by current task.
+ * If wait condition isn't met, task is blocked till set of events meets it or timeout.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Events 			--> Bits of waited events.
+ * @param  WaitAll 			--> Edu_True to wait all events, Edu_False to wait any of them.
+ * @param  ClearOnExit 		--> Edu_True to clear waited events once condition is met.
+ * @param  ReceivedEvents 	--> Events when condition is met (or at timeout) before they are cleared, It may be NULL.
+ * @param  TicksToWait 		--> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> EduRTOS_StdType_Status_Succeed if condition is met, Otherwise EduRTOS_StdType_Status_Timeout.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskWait_EventGroup(EventGroup * const Arg_EventGroup, const Edu_u32 Events, const Edu_Bool WaitAll,
+		const Edu_Bool ClearOnExit, Edu_u32 * const ReceivedEvents, const Edu_u32 TicksToWait);
+
+/* @brief  					--> Set events of event group, and wake up all waiting tasks that their condition is met in one pass over wait list.
+ * @param  Arg_EventGroup 	--> Pointer of event group.
+ * @param  Events 			--> Bits of events that are set.
+ * @retval --> Events after setting them and clearing events of woken tasks that clear them on exit.
+ * */
+Edu_u32 EduRTOS_TaskSet_EventGroup(EventGroup * const Arg_EventGroup, const Edu_u32 Events);
+
+/* @brief  							--> Set events of event group from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_EventGroup 			--> Pointer of event group.
+ * @param  Events 					--> Bits of events that are set.
+ * @param  HigherPriorityTaskWoken 	--> It's set to Edu_True if any woken task has higher priority than interrupted task, It may be NULL.
+ * @retval --> Same as EduRTOS_TaskSet_EventGroup.
+ * */
+Edu_u32 EduRTOS_TaskSet_EventGroupFromISR(EventGroup * const Arg_EventGroup, const Edu_u32 Events, Edu_Bool * const HigherPriorityTaskWoken);
+#endif
+
+#if EduRTOS_Config_USE_MEMORY_POOL
+/* @brief  					--> Allocate block of memory pool by current task.
+ * If pool is empty, task is blocked till block is freed and given to it or timeout.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  TicksToWait 		--> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> Address of block, or NULL if timeout is passed.
+ * */
+void *EduRTOS_TaskAllocate_MemoryPool(MemoryPool * const Arg_MemoryPool, const Edu_u32 TicksToWait);
 
-void EduRTOS_TaskUnBlock_Mutex(Mutex * const Arg_Mutex);
-void EduRTOS_TaskUnBlock_Semaphore(Semaphore * const Arg_Semaphore);
+/* @brief  					--> Allocate block of memory pool from interrupt handler, It never blocks.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @retval --> Address of block, or NULL if pool is empty.
+ * */
+void *EduRTOS_TaskAllocate_MemoryPoolFromISR(MemoryPool * const Arg_MemoryPool);
+
+/* @brief  					--> Free block of memory pool, It's given to highest priority waiting task (if any) without passing through free list.
+ * @param  Arg_MemoryPool 	--> Pointer of memory pool.
+ * @param  Block 			--> Address of block of pool, It's checked by caller.
+ * @retval --> EduRTOS_StdType_Status_Fail if block is already free.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskFree_MemoryPool(MemoryPool * const Arg_MemoryPool, void * const Block);
+
+/* @brief  							--> Free block of memory pool from interrupt handler, It never blocks and never switches context.
+ * @param  Arg_MemoryPool 			--> Pointer of memory pool.
+ * @param  Block 					--> Address of block of pool, It's checked by caller.
+ * @param  HigherPriorityTaskWoken 	--> It's set to Edu_True if woken task has higher priority than interrupted task, It may be NULL.
+ * @retval --> EduRTOS_StdType_Status_Fail if block is already free.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskFree_MemoryPoolFromISR(MemoryPool * const Arg_MemoryPool, void * const Block, Edu_Bool * const HigherPriorityTaskWoken);
+#endif
+
+#if EduRTOS_Config_USE_TASK_NOTIFICATION
+/* @brief  				--> Notify task by updating its notification value, If task waits notification it's woken up.
+ * @param  TargetTaskId --> Id of task returned by EduRTOS_CreateTask, Idle task can't be notified (it never waits notification).
+ * @param  Value 		--> Value that is used by action.
+ * @param  Action 		--> Update of notification value.
+ * @retval --> EduRTOS_StdType_Status_Fail if action is EduTask_Notify_SetValue and previous notification isn't received,
+ * Otherwise EduRTOS_StdType_Status_Succeed.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskNotify(const TaskId TargetTaskId, const Edu_u32 Value, const EduTask_NotifyAction Action);
+
+/* @brief  							--> Notify task from interrupt handler, It never blocks and never switches context.
+ * @param  TargetTaskId 			--> Id of task, Idle task can't be notified.
+ * @param  Value 					--> Value that is used by action.
+ * @param  Action 					--> Update of notification value.
+ * @param  HigherPriorityTaskWoken 	--> It's set to Edu_True if woken task has higher priority than interrupted task, It may be NULL.
+ * @retval --> Same as EduRTOS_TaskNotify.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskNotifyFromISR(const TaskId TargetTaskId, const Edu_u32 Value, const EduTask_NotifyAction Action,
+		Edu_Bool * const HigherPriorityTaskWoken);
+
+/* @brief  					--> Wait notification of current task, If it's already notified it returns immediately.
+ * @param  ClearBitsOnEntry --> Bits cleared from notification value before waiting (only if task isn't notified yet).
+ * @param  ClearBitsOnExit 	--> Bits cleared from notification value after it's received.
+ * @param  Value 			--> Notification value before clearing bits on exit, It may be NULL.
+ * @param  TicksToWait 		--> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> EduRTOS_StdType_Status_Succeed if notification is received, Otherwise EduRTOS_StdType_Status_Timeout.
+ * */
+EduRTOS_StdType_Status EduRTOS_TaskNotifyWait(const Edu_u32 ClearBitsOnEntry, const Edu_u32 ClearBitsOnExit,
+		Edu_u32 * const Value, const Edu_u32 TicksToWait);
+
+/* @brief  				--> Take notification value of current task as counting semaphore (notified by EduTask_Notify_Increment).
+ * If value is zero, task is blocked till it's notified or timeout.
+ * @param  ClearOnExit 	--> Edu_True to clear value (Binary semaphore), Edu_False to decrement it (Counting semaphore).
+ * @param  TicksToWait 	--> Maximum number of ticks to wait, 0 to return immediately or EduRTOS_INFINITE to wait forever.
+ * @retval --> Notification value before it's decremented or cleared, 0 if timeout is passed.
+ * */
+Edu_u32 EduRTOS_TaskNotifyTake(const Edu_Bool ClearOnExit, const Edu_u32 TicksToWait);
+#endif
+
+#if EduRTOS_Config_USE_TICKLESS_IDLE
+/* @brief  --> Called by idle task, If idle task is the only ready task, It stops periodic tick, sleeps till
+ * wakeup tick of the nearest delayed task (or any interrupt) and then adds missed ticks.
+ * */
+void EduRTOS_TicklessIdle(void);
+
+/* @brief  --> Get number of ticks that processor spent in sleep since scheduler is started.
+ * @retval --> Number of ticks.
+ * */
+Edu_u32 EduRTOS_GetSleepTicks(void);
+
+/* @brief  --> Get percentage of time that processor spent in sleep since scheduler is started.
+ * @retval --> Percentage from 0 to 100.
+ * */
+Edu_u32 EduRTOS_GetSleepTimePercentage(void);
+#endif
+
+#if EduRTOS_Config_USE_STACK_WATERMARK
+/* @brief  				--> Get maximum stack usage of task since its creation, It's found by scanning fill pattern from bottom of stack.
+ * @param  TargetTaskId --> Id of task returned by EduRTOS_CreateTask.
+ * @retval --> Maximum number of used bytes, or 0 if task isn't created.
+ * */
+Edu_u32 EduRTOS_GetTaskStackHighWaterMark(const TaskId TargetTaskId);
+
+/* @brief  					  --> Get stack usage and suggested stack size of created tasks in order of their ids (idle task is last).
+ * @param  Reports 			  --> Array that is filled with stack usage of tasks.
+ * @param  MaxNumberOfReports --> Length of array.
+ * @retval --> Number of filled elements.
+ * */
+Edu_u32 EduRTOS_GetStackReport(EduRTOS_StackReport * const Reports, const Edu_u32 MaxNumberOfReports);
+#endif
+
+#if EduRTOS_Config_USE_RUNTIME_STATS
+/* @brief  					--> Get snapshot of runtime statistics of created tasks in order of their ids (idle task is last).
+ * Run time of current task is counted till call of this function.
+ * @param  Stats 			--> Array that is filled with statistics of tasks.
+ * @param  MaxNumberOfStats --> Length of array.
+ * @retval --> Number of filled elements.
+ * */
+Edu_u32 EduRTOS_GetTasksStats(EduRTOS_TaskStats * const Stats, const Edu_u32 MaxNumberOfStats);
+
+/* @brief  --> Get percentage of time that processor spent running tasks other than idle task since start (or reset) of statistics.
+ * @retval --> Percentage from 0 to 100.
+ * */
+Edu_u32 EduRTOS_GetCpuLoadPercentage(void);
+
+/* @brief  --> Clear run time and switching in count of all tasks, So statistics are measured from now.
+ * */
+void EduRTOS_ResetRuntimeStats(void);
+#endif
 
 Edu_u32 EduRTOS_GetCurrentTickNumber(void);
 Edu_u32 EduRTOS_GetCurrentRunningTask(void);
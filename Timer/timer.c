@@ -0,0 +1,152 @@
+/*
+ * File Name --> timer.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Software timers implementation, Callbacks of all timers run in one timer service task.
+ * */
+
+#include "timer.h"
+#include "Task/task.h"
+#include "Port/port.h"
+
+#if EduRTOS_Config_USE_SOFTWARE_TIMER
+
+/*Running timers sorted by expiry tick, So service task only checks head of list.*/
+static EduRTOS_List SoftwareTimer_ActiveList;
+
+/*Timers aren't started till service task (and active list) exists.*/
+static TaskId SoftwareTimer_ServiceTaskId = EduRTOS_INVALID_TASK;
+
+/* @brief  				--> Insert timer in active timers list, It must be called inside critical section.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @param  ExpiryTick 	--> Tick at which timer expires.
+ * @retval --> Edu_True if timer is the nearest one to expire, So service task has to recalculate its waiting time.
+ * */
+static Edu_Bool SoftwareTimerInsert(SoftwareTimer * const Arg_Timer, const Edu_u32 ExpiryTick){
+	Arg_Timer->ActiveListItem.ItemValue = ExpiryTick;
+	EduRTOS_ListInsertOrdered(&SoftwareTimer_ActiveList, &Arg_Timer->ActiveListItem);
+	return (EduRTOS_ListGetHead(&SoftwareTimer_ActiveList) == &Arg_Timer->ActiveListItem) ? Edu_True : Edu_False;
+}
+
+/* @brief  				--> Start timer from now, It's removed first if it's running.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @param  Restart 		--> Edu_False to keep timer unchanged if it's running.
+ * */
+static void SoftwareTimerRestart(SoftwareTimer * const Arg_Timer, const Edu_Bool Restart){
+	Edu_Bool IsServiceTaskWakeupRequired = Edu_False;
+
+	EduRTOS_EnterCritical();
+	if ((Edu_True == Restart) || (!EduRTOS_ListItemIsInserted(&Arg_Timer->ActiveListItem))){
+		EduRTOS_ListRemove(&Arg_Timer->ActiveListItem);
+		IsServiceTaskWakeupRequired = SoftwareTimerInsert(Arg_Timer, EduRTOS_GetCurrentTickNumber() + Arg_Timer->Period);
+	}
+	EduRTOS_ExitCritical();
+
+	/*Service task waits till expiry of previous head, so it's woken up to wait new head instead.*/
+	if (Edu_True == IsServiceTaskWakeupRequired){
+		EduRTOS_TaskNotify(SoftwareTimer_ServiceTaskId, 0, EduTask_Notify_Increment);
+	}
+}
+
+static void SoftwareTimerServiceTask(void){
+	while(1){
+		Edu_u32 TicksToWait = EduRTOS_INFINITE;
+
+		EduRTOS_EnterCritical();
+		if (!EduRTOS_ListIsEmpty(&SoftwareTimer_ActiveList)){
+			EduRTOS_ListItem * const HeadItem = EduRTOS_ListGetHead(&SoftwareTimer_ActiveList);
+			SoftwareTimer * const ExpiredTimer = (SoftwareTimer *)HeadItem->Owner;
+			const Edu_s32 RemainingTicks = (Edu_s32)(HeadItem->ItemValue - EduRTOS_GetCurrentTickNumber());
+
+			if (RemainingTicks <= 0){
+				EduRTOS_ListRemove(HeadItem);
+				/*Next expiry follows previous one (not time of callback), So periodic timer doesn't drift.*/
+				if (Edu_True == ExpiredTimer->AutoReload){
+					(void)SoftwareTimerInsert(ExpiredTimer, HeadItem->ItemValue + ExpiredTimer->Period);
+				}
+				EduRTOS_ExitCritical();
+				/*Callback may start, stop or change any timer (including its own).*/
+				ExpiredTimer->Callback(ExpiredTimer);
+				continue;
+			}
+			TicksToWait = (Edu_u32)RemainingTicks;
+		}
+		EduRTOS_ExitCritical();
+
+		/*Task sleeps till nearest expiry, or till timer that expires before it is started (notification isn't lost
+		 * if it's sent before task waits).*/
+		(void)EduRTOS_TaskNotifyTake(Edu_True, TicksToWait);
+	}
+}
+
+void SoftwareTimerServiceInit(void){
+	EduRTOS_ListInit(&SoftwareTimer_ActiveList);
+	SoftwareTimer_ServiceTaskId = EduRTOS_CreateTask(SoftwareTimerServiceTask, EduRTOS_Config_TIMER_TASK_PRIORITY,
+			EduRTOS_Config_TIMER_TASK_STACK_SIZE, EduRTOS_NULL);
+	/*No timer would ever expire without service task.*/
+	if (EduRTOS_INVALID_TASK == SoftwareTimer_ServiceTaskId){
+		EduRTOS_ErrorHandler();
+	}
+}
+
+EduRTOS_StdType_Status SoftwareTimerInit(SoftwareTimer * const Arg_Timer, void (* const Arg_Callback)(SoftwareTimer * const Timer),
+		const Edu_u32 Arg_Period, const Edu_Bool Arg_AutoReload, void * const Arg_Context){
+	if ((EduRTOS_NULL == Arg_Timer) || (EduRTOS_NULL == Arg_Callback) || (0 == Arg_Period)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	Arg_Timer->Period = Arg_Period;
+	Arg_Timer->AutoReload = Arg_AutoReload;
+	Arg_Timer->Callback = Arg_Callback;
+	Arg_Timer->Context = Arg_Context;
+	/*Timer isn't running*/
+	EduRTOS_ListItemInit(&Arg_Timer->ActiveListItem, (void *)Arg_Timer);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+EduRTOS_StdType_Status SoftwareTimerStart(SoftwareTimer * const Arg_Timer){
+	if ((EduRTOS_NULL == Arg_Timer) || (EduRTOS_INVALID_TASK == SoftwareTimer_ServiceTaskId)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	SoftwareTimerRestart(Arg_Timer, Edu_False);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+EduRTOS_StdType_Status SoftwareTimerStop(SoftwareTimer * const Arg_Timer){
+	if (EduRTOS_NULL == Arg_Timer){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	/*Service task may wake up at expiry of stopped timer, then it finds that head is changed.*/
+	EduRTOS_EnterCritical();
+	EduRTOS_ListRemove(&Arg_Timer->ActiveListItem);
+	EduRTOS_ExitCritical();
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+EduRTOS_StdType_Status SoftwareTimerReset(SoftwareTimer * const Arg_Timer){
+	if ((EduRTOS_NULL == Arg_Timer) || (EduRTOS_INVALID_TASK == SoftwareTimer_ServiceTaskId)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	SoftwareTimerRestart(Arg_Timer, Edu_True);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+EduRTOS_StdType_Status SoftwareTimerChangePeriod(SoftwareTimer * const Arg_Timer, const Edu_u32 Arg_Period){
+	if ((EduRTOS_NULL == Arg_Timer) || (0 == Arg_Period) || (EduRTOS_INVALID_TASK == SoftwareTimer_ServiceTaskId)){
+		return EduRTOS_StdType_Status_Fail;
+	}
+	EduRTOS_EnterCritical();
+	Arg_Timer->Period = Arg_Period;
+	EduRTOS_ExitCritical();
+	SoftwareTimerRestart(Arg_Timer, Edu_True);
+	return EduRTOS_StdType_Status_Succeed;
+}
+
+Edu_Bool SoftwareTimerIsActive(SoftwareTimer * const Arg_Timer){
+	if (EduRTOS_NULL == Arg_Timer){
+		return Edu_False;
+	}
+	return EduRTOS_ListItemIsInserted(&Arg_Timer->ActiveListItem) ? Edu_True : Edu_False;
+}
+
+#endif
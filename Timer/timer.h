@@ -0,0 +1,106 @@
+/*
+ * File Name --> timer.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides API for Software timers.
+ * */
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+#include "List/list.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Software timer defines
+==================================================
+ */
+typedef struct SoftwareTimer{
+	/*Links timer in active timers list sorted by expiry tick (ItemValue).*/
+	EduRTOS_ListItem ActiveListItem;
+	/*Period in ticks.*/
+	Edu_u32 Period;
+	/*Edu_True to restart timer every period, Edu_False to stop it after it expires once.*/
+	Edu_Bool AutoReload;
+	/*It runs in timer service task, so it must not block for long time.*/
+	void (*Callback)(struct SoftwareTimer * const Timer);
+	/*Application data of callback.*/
+	void *Context;
+}SoftwareTimer;
+/*
+==================================================
+  End Section --> Software timer defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+
+/* @brief  				--> Create timer service task, It's called by EduRTOS_Init.
+ * EduRTOS_ErrorHandler is called if task can't be created (no free TCB or stack).
+ * */
+void SoftwareTimerServiceInit(void);
+
+/* @brief  					--> Initialize Software timer, Timer is stopped till it's started.
+ * @param  Arg_Timer 		--> Pointer of timer.
+ * @param  Arg_Callback 	--> Function called by timer service task when timer expires.
+ * @param  Arg_Period 		--> Period in ticks, It must not be 0.
+ * @param  Arg_AutoReload 	--> Edu_True for periodic timer, Edu_False for one-shot timer.
+ * @param  Arg_Context 		--> Application data of callback, It's stored in Context of timer.
+ * @retval --> Status if it's initialized successfully or not.
+ * */
+EduRTOS_StdType_Status SoftwareTimerInit(SoftwareTimer * const Arg_Timer, void (* const Arg_Callback)(SoftwareTimer * const Timer),
+		const Edu_u32 Arg_Period, const Edu_Bool Arg_AutoReload, void * const Arg_Context);
+
+/* @brief  				--> Start timer, It expires after one period from now. If it's already running it isn't changed.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @retval --> Status if it's started successfully or not, It fails before EduRTOS_Init (timer service task doesn't exist).
+ * */
+EduRTOS_StdType_Status SoftwareTimerStart(SoftwareTimer * const Arg_Timer);
+
+/* @brief  				--> Stop timer, Its callback isn't called till it's started again.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @retval --> Status if it's stopped successfully or not.
+ * */
+EduRTOS_StdType_Status SoftwareTimerStop(SoftwareTimer * const Arg_Timer);
+
+/* @brief  				--> Restart timer, It expires after one period from now whether it's running or not.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @retval --> Status if it's restarted successfully or not, It fails before EduRTOS_Init.
+ * */
+EduRTOS_StdType_Status SoftwareTimerReset(SoftwareTimer * const Arg_Timer);
+
+/* @brief  				--> Change period of timer and restart it, It expires after new period from now.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @param  Arg_Period 	--> New period in ticks, It must not be 0.
+ * @retval --> Status if period is changed successfully or not, It fails (and period isn't changed) before EduRTOS_Init.
+ * */
+EduRTOS_StdType_Status SoftwareTimerChangePeriod(SoftwareTimer * const Arg_Timer, const Edu_u32 Arg_Period);
+
+/* @brief  				--> Check whether timer is running.
+ * @param  Arg_Timer 	--> Pointer of timer.
+ * @retval --> Edu_True if timer is running.
+ * */
+Edu_Bool SoftwareTimerIsActive(SoftwareTimer * const Arg_Timer);
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+#endif /* TIMER_H_ */
@@ -0,0 +1,45 @@
+/*
+ * File Name --> trace.c
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides implementation functions for tracing kernel events.
+ * */
+
+#include "EduRTOS.h"
+#include "Trace/trace.h"
+
+#if EduRTOS_Config_USE_TRACE
+
+EduRTOS_TraceBufferType EduRTOS_TraceBuffer = {
+	.Magic 				= EduRTOS_TRACE_MAGIC,
+	.Version 			= EduRTOS_TRACE_VERSION,
+	.RecordSize 		= sizeof(EduRTOS_TraceRecord),
+	.BufferSize 		= EduRTOS_Config_TRACE_BUFFER_SIZE,
+	.TimestampHz 		= EduRTOS_Port_TIMESTAMP_HZ,
+	.MaxNumberOfTasks 	= EduRTOS_Config_MAX_NUMBER_OF_TASKS,
+	.Head 				= 0,
+	.Enabled 			= 1,
+};
+
+void EduRTOS_TraceStart(void){
+	EduRTOS_TraceBuffer.Enabled = 1;
+}
+
+void EduRTOS_TraceStop(void){
+	EduRTOS_TraceBuffer.Enabled = 0;
+}
+
+void EduRTOS_TraceUserEvent(const Edu_u8 Code){
+	EduRTOS_TraceRecordEvent(EduRTOS_TraceEvent_User, EduRTOS_GetCurrentRunningTask(), Code);
+}
+
+void EduRTOS_TraceDump(void (* const Write)(const void *Data, Edu_u32 Size)){
+	const Edu_u32 WasEnabled = EduRTOS_TraceBuffer.Enabled;
+	/*Records aren't changed while they are written.*/
+	EduRTOS_TraceBuffer.Enabled = 0;
+	Write((const void *)&EduRTOS_TraceBuffer, sizeof(EduRTOS_TraceBuffer));
+	EduRTOS_TraceBuffer.Enabled = WasEnabled;
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * File Name --> trace.h
+ * Author	 --> Ahmed Mohamed Abd-Elfattah
+ * Version	 --> 1.0.0
+ * Layer	 --> RTOS
+ * Brief	 --> Provides API for tracing kernel events in lock-free ring buffer.
+ * */
+
+#ifndef EDUCATIONALRTOS_TRACE_H_
+#define EDUCATIONALRTOS_TRACE_H_
+
+/*
+==================================================
+  Start Section --> File Includes
+==================================================
+ */
+#include "EduRTOS_Config.h"
+#include "EduRTOS_defines.h"
+#include "Port/port.h"
+/*
+==================================================
+  End Section --> File Includes
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> Trace defines
+==================================================
+ */
+
+#if (EduRTOS_Config_TRACE_BUFFER_SIZE & (EduRTOS_Config_TRACE_BUFFER_SIZE - 1)) != 0
+#error "EduRTOS_Config_TRACE_BUFFER_SIZE must be power of 2"
+#endif
+
+/*"EDUT" in little endian, It's used by decoder to find buffer in memory dump.*/
+#define 	EduRTOS_TRACE_MAGIC				0x54554445UL
+#define 	EduRTOS_TRACE_VERSION			1
+
+typedef enum{
+	/*Task is created, Data is priority of task.*/
+	EduRTOS_TraceEvent_TaskCreate = 1,
+	/*Task is switched in, Data is 0.*/
+	EduRTOS_TraceEvent_Switch,
+	/*Task is blocked, Data is blocking reason (EduTask_BlockingReason).*/
+	EduRTOS_TraceEvent_Block,
+	/*Task is unblocked, Data is wait result (Succeed if it's woken up by object, Timeout if it's woken up by tick).*/
+	EduRTOS_TraceEvent_Unblock,
+	/*Event recorded by application through EduRTOS_TraceUserEvent, Data is user code.*/
+	EduRTOS_TraceEvent_User,
+}EduTrace_Event;
+
+typedef struct{
+	/*Port timestamp (EduRTOS_Port_Timestamp), It wraps around so decoder extends it.*/
+	Edu_u32 Timestamp;
+	Edu_u16 TaskId;
+	Edu_u8  Event;
+	Edu_u8  Data;
+}EduRTOS_TraceRecord;
+
+/*
+ * Memory image of trace buffer, It's dumped as it is (by EduRTOS_TraceDump or by debugger),
+ * So header fields are fixed size and decoder doesn't need kernel configurations.
+ * */
+typedef struct{
+	Edu_u32 Magic;
+	Edu_u16 Version;
+	Edu_u16 RecordSize;
+	Edu_u32 BufferSize;
+	Edu_u32 TimestampHz;
+	Edu_u32 MaxNumberOfTasks;
+	/*Number of records written since start, Next record is written at (Head % BufferSize).*/
+	volatile Edu_u32 Head;
+	volatile Edu_u32 Enabled;
+	EduRTOS_TraceRecord Records[EduRTOS_Config_TRACE_BUFFER_SIZE];
+}EduRTOS_TraceBufferType;
+
+extern EduRTOS_TraceBufferType EduRTOS_TraceBuffer;
+
+/*
+==================================================
+  End Section --> Trace defines
+==================================================
+ */
+
+/*
+==================================================
+  Start Section --> APIs
+==================================================
+ */
+#if EduRTOS_Config_USE_TRACE
+
+/* @brief  			--> Record event in trace buffer, It may be called from tasks and interrupts.
+ * Slot is reserved by atomic increment of head, So writers never wait each other and interrupts aren't disabled.
+ * @param  Event 	--> Event type.
+ * @param  TaskId 	--> Id of task.
+ * @param  Data 	--> Data of event.
+ * */
+static inline __attribute__((always_inline)) void EduRTOS_TraceRecordEvent(const EduTrace_Event Event, const Edu_u32 TaskId, const Edu_u8 Data){
+	if (EduRTOS_TraceBuffer.Enabled){
+		const Edu_u32 Index = __atomic_fetch_add(&EduRTOS_TraceBuffer.Head, 1, __ATOMIC_RELAXED) & (EduRTOS_Config_TRACE_BUFFER_SIZE - 1);
+		EduRTOS_TraceRecord * const Record = &EduRTOS_TraceBuffer.Records[Index];
+		Record->Timestamp = EduRTOS_Port_Timestamp();
+		Record->TaskId = (Edu_u16)TaskId;
+		Record->Event = (Edu_u8)Event;
+		Record->Data = Data;
+	}
+}
+
+/* @brief  --> Start recording events (Recording is started by default).
+ * */
+void EduRTOS_TraceStart(void);
+
+/* @brief  --> Stop recording events, Buffer keeps last recorded events.
+ * */
+void EduRTOS_TraceStop(void);
+
+/* @brief  		--> Record application event for current task, It appears as instant event on task timeline.
+ * @param  Code --> User code of event.
+ * */
+void EduRTOS_TraceUserEvent(const Edu_u8 Code);
+
+/* @brief  			--> Stop recording and write memory image of trace buffer, then recording is restored.
+ * @param  Write 	--> Function that writes bytes (to file, UART, ... etc), It's called once for whole buffer.
+ * */
+void EduRTOS_TraceDump(void (* const Write)(const void *Data, Edu_u32 Size));
+
+#endif
+/*
+==================================================
+  End Section --> APIs
+==================================================
+ */
+
+/*Kernel records events through this macro, So trace costs nothing when it isn't used.*/
+#if EduRTOS_Config_USE_TRACE
+#define 	EduRTOS_TRACE(Event, TaskId, Data)		EduRTOS_TraceRecordEvent((Event), (TaskId), (Data))
+#else
+#define 	EduRTOS_TRACE(Event, TaskId, Data)
+#endif
+
+#endif /* EDUCATIONALRTOS_TRACE_H_ */
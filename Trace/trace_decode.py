@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+File Name --> trace_decode.py
+Author    --> Ahmed Mohamed Abd-Elfattah
+Version   --> 1.0.0
+Brief     --> Convert dump of EduRTOS trace buffer to Chrome trace JSON, It's opened by
+              https://ui.perfetto.dev or chrome://tracing. Each task is a thread that shows
+              its running and blocked periods, and tick wakeups and user events as instant events.
+
+Input     --> Binary memory image of "EduRTOS_TraceBuffer" (EduRTOS_TraceDump or debugger dump,
+              buffer is found by its magic so larger memory dumps are accepted), or text log that
+              has "EDUTRACE <hex>" lines (like output of Demo built with -DEDURTOS_TRACE=ON).
+
+Usage     --> python3 Trace/trace_decode.py trace.bin -o trace.json
+              python3 Trace/trace_decode.py demo_output.txt -o trace.json --name 2=Checker
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"EDUT"
+HEADER_FORMAT = "<IHHIIIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_FORMAT = "<IHBB"
+SUPPORTED_VERSION = 1
+
+# Values of EduTrace_Event (Trace/trace.h).
+EVENT_TASK_CREATE = 1
+EVENT_SWITCH = 2
+EVENT_BLOCK = 3
+EVENT_UNBLOCK = 4
+EVENT_USER = 5
+
+# Values of EduTask_BlockingReason (Task/task.h).
+BLOCKING_REASONS = {0: "delay", 1: "mutex", 2: "semaphore", 3: "notification", 4: "events", 5: "memory pool"}
+# Values of EduRTOS_StdType_Status (EduRTOS_defines.h).
+WAIT_RESULTS = {0: "fail", 1: "timeout", 2: "object"}
+
+PROCESS_ID = 1
+
+
+def read_dump(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    # Text log, hex of buffer follows "EDUTRACE" prefix.
+    hex_text = "".join(line.split(None, 1)[1].strip()
+                       for line in data.decode("ascii", "replace").splitlines()
+                       if line.startswith("EDUTRACE ") and len(line.split(None, 1)) == 2)
+    if hex_text:
+        data = bytes.fromhex(hex_text)
+    if MAGIC not in data:
+        raise ValueError("%s doesn't contain EduRTOS trace buffer" % path)
+    return data[data.index(MAGIC):]
+
+
+def parse_buffer(data):
+    magic, version, record_size, buffer_size, timestamp_hz, max_tasks, head, _enabled = \
+        struct.unpack_from(HEADER_FORMAT, data, 0)
+    if version != SUPPORTED_VERSION or record_size != struct.calcsize(RECORD_FORMAT):
+        raise ValueError("Unsupported trace version %d (record size %d)" % (version, record_size))
+    if len(data) < HEADER_SIZE + buffer_size * record_size:
+        raise ValueError("Dump is shorter than trace buffer")
+
+    # Ring buffer keeps last buffer_size records, the oldest one is at head.
+    count = min(head, buffer_size)
+    records = []
+    for i in range(head - count, head):
+        offset = HEADER_SIZE + (i % buffer_size) * record_size
+        records.append(struct.unpack_from(RECORD_FORMAT, data, offset))
+
+    header = {"timestamp_hz": timestamp_hz, "max_tasks": max_tasks,
+              "written": head, "dropped": head - count}
+    return header, records
+
+
+def extend_timestamps(records):
+    """Timestamps are 32-bit and wrap around, consecutive records are assumed less than half wrap period apart."""
+    extended = []
+    total = 0
+    previous = None
+    for record in records:
+        if previous is not None:
+            delta = (record[0] - previous) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                # Record written by interrupt between slot reservation and timestamp.
+                delta -= 0x100000000
+            total += delta
+        previous = record[0]
+        extended.append(total)
+    return extended
+
+
+def task_name(task_id, max_tasks, priorities, names):
+    if task_id in names:
+        return names[task_id]
+    if task_id == max_tasks:
+        return "Idle"
+    # Task id isn't related to priority, so priority is known only if creation of task is recorded.
+    if task_id in priorities:
+        return "Task %d (priority %d)" % (task_id, priorities[task_id])
+    return "Task %d" % task_id
+
+
+def convert(header, records, names):
+    hz = header["timestamp_hz"]
+    max_tasks = header["max_tasks"]
+    times = [counts * 1000000.0 / hz for counts in extend_timestamps(records)]
+
+    events = [{"ph": "M", "pid": PROCESS_ID, "name": "process_name", "args": {"name": "EduRTOS"}}]
+    tasks = set()
+    priorities = {}
+    running_task = None
+    running_since = None
+    # Blocking reason of task, and time it's switched out after blocking.
+    pending_blocks = {}
+    blocked_since = {}
+
+    def slice_event(name, task_id, start, end, args=None):
+        event = {"ph": "X", "pid": PROCESS_ID, "tid": task_id, "name": name,
+                 "ts": start, "dur": max(end - start, 0.0)}
+        if args:
+            event["args"] = args
+        events.append(event)
+
+    def instant_event(name, task_id, time, args=None):
+        event = {"ph": "i", "s": "t", "pid": PROCESS_ID, "tid": task_id, "name": name, "ts": time}
+        if args:
+            event["args"] = args
+        events.append(event)
+
+    for (timestamp, task_id, event, data), time in zip(records, times):
+        tasks.add(task_id)
+        if event == EVENT_SWITCH:
+            if running_task is not None:
+                slice_event("Running", running_task, running_since, time)
+                if running_task in pending_blocks:
+                    blocked_since[running_task] = time
+            running_task = task_id
+            running_since = time
+        elif event == EVENT_BLOCK:
+            pending_blocks[task_id] = BLOCKING_REASONS.get(data, str(data))
+        elif event == EVENT_UNBLOCK:
+            result = WAIT_RESULTS.get(data, str(data))
+            reason = pending_blocks.pop(task_id, None)
+            since = blocked_since.pop(task_id, None)
+            if reason is not None and since is not None:
+                slice_event("Blocked (%s)" % reason, task_id, since, time, {"woken_by": result})
+            if result == "timeout":
+                instant_event("Tick wakeup", task_id, time)
+        elif event == EVENT_TASK_CREATE:
+            priorities[task_id] = data
+            instant_event("Created", task_id, time, {"priority": data})
+        elif event == EVENT_USER:
+            instant_event("User %d" % data, task_id, time, {"code": data})
+
+    if running_task is not None and times:
+        slice_event("Running", running_task, running_since, times[-1])
+
+    for task_id in sorted(tasks):
+        events.append({"ph": "M", "pid": PROCESS_ID, "tid": task_id, "name": "thread_name",
+                       "args": {"name": task_name(task_id, max_tasks, priorities, names)}})
+        # Higher priority tasks are shown first, then tasks of the same priority in order of their ids.
+        priority = 0 if task_id == max_tasks else priorities.get(task_id, 0)
+        events.append({"ph": "M", "pid": PROCESS_ID, "tid": task_id, "name": "thread_sort_index",
+                       "args": {"sort_index": (255 - priority) * (max_tasks + 1) + task_id}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns",
+            "otherData": {"timestamp_hz": hz, "records": len(records), "dropped": header["dropped"]}}
+
+
+def parse_names(values):
+    names = {}
+    for value in values:
+        task_id, name = value.split("=", 1)
+        names[int(task_id, 0)] = name
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert EduRTOS trace buffer dump to Chrome trace JSON.")
+    parser.add_argument("dump", help="Binary dump of EduRTOS_TraceBuffer or text log with EDUTRACE lines")
+    parser.add_argument("-o", "--output", default="-", help="Output JSON file (default stdout)")
+    parser.add_argument("--name", action="append", default=[], metavar="ID=NAME",
+                        help="Name of task id, It may be repeated")
+    args = parser.parse_args()
+
+    header, records = parse_buffer(read_dump(args.dump))
+    trace = convert(header, records, parse_names(args.name))
+
+    output = sys.stdout if args.output == "-" else open(args.output, "w")
+    json.dump(trace, output)
+    if output is not sys.stdout:
+        output.close()
+    sys.stderr.write("%d records decoded, %d older records were overwritten\n"
+                     % (len(records), header["dropped"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())